@@ -0,0 +1,120 @@
+// Size and throughput of chunked compression on the bytecode table of the example block,
+// serialized in plain and compact formats.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "zkevm_framework/assigner_runner/compression.hpp"
+#include "zkevm_framework/assigner_runner/runner.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+#include "zkevm_framework/preset/preset.hpp"
+
+namespace {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using Endianness = nil::marshalling::option::big_endian;
+
+    // Serialized bytecode table of the example block by table format
+    const std::string& BytecodeTable(table_format format) {
+        static const auto tables = [] {
+            zkevm_circuits<ArithmetizationType> circuits;
+            std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                               nil::blueprint::assignment<ArithmetizationType>>
+                assignments;
+            auto err = initialize_circuits<BlueprintFieldType>(circuits, assignments);
+            single_thread_runner<BlueprintFieldType> runner(assignments, 0,
+                                                            circuits.get_circuit_names(),
+                                                            boost::log::trivial::warning);
+            if (!err) {
+                err = runner.extract_block_with_messages("", BLOCK_CONFIG);
+            }
+            if (!err) {
+                err = runner.extract_accounts_with_storage(STATE_CONFIG);
+            }
+            if (!err) {
+                err = runner.execute();
+            }
+            if (err) {
+                std::cerr << "Cannot fill bytecode table: " << err.value() << std::endl;
+                std::exit(1);
+            }
+            const auto& table = assignments.at(nil::evm_assigner::zkevm_circuit::BYTECODE);
+            std::unordered_map<table_format, std::string> result;
+            for (auto f : {table_format::plain, table_format::compact}) {
+                std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+                write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+                    table, 0, usable_rows(table), out, f);
+                result[f] = std::move(out).str();
+            }
+            return result;
+        }();
+        return tables.at(format);
+    }
+
+    // Arguments: table format, codec, level, threads
+    void BM_CompressTable(benchmark::State& state) {
+        const auto& data = BytecodeTable(static_cast<table_format>(state.range(0)));
+        compression_options options{.codec = static_cast<compression_codec>(state.range(1)),
+                                    .level = static_cast<int>(state.range(2)),
+                                    .threads = static_cast<std::size_t>(state.range(3))};
+        std::size_t compressed_size = 0;
+        for (auto _ : state) {
+            const auto compressed = compress_chunked(data, options);
+            compressed_size = compressed.size();
+            benchmark::DoNotOptimize(compressed.data());
+        }
+        state.SetBytesProcessed(state.iterations() * data.size());
+        state.counters["table_bytes"] = static_cast<double>(data.size());
+        state.counters["compressed_bytes"] = static_cast<double>(compressed_size);
+        state.counters["ratio"] = static_cast<double>(data.size()) / compressed_size;
+    }
+
+    // Arguments: table format, codec
+    void BM_DecompressTable(benchmark::State& state) {
+        const auto& data = BytecodeTable(static_cast<table_format>(state.range(0)));
+        const auto compressed = compress_chunked(
+            data, {.codec = static_cast<compression_codec>(state.range(1))});
+        for (auto _ : state) {
+            std::istringstream in(compressed);
+            chunked_decompressor reader;
+            std::string out;
+            if (reader.open(in) || reader.read(0, reader.size(), out)) {
+                state.SkipWithError("Cannot decompress table");
+                break;
+            }
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetBytesProcessed(state.iterations() * data.size());
+    }
+}  // namespace
+
+constexpr int kPlain = static_cast<int>(table_format::plain);
+constexpr int kCompact = static_cast<int>(table_format::compact);
+constexpr int kGzip = static_cast<int>(compression_codec::gzip);
+constexpr int kZstd = static_cast<int>(compression_codec::zstd);
+
+BENCHMARK(BM_CompressTable)
+    ->ArgNames({"format", "codec", "level", "threads"})
+    ->Args({kPlain, kGzip, 6, 1})
+    ->Args({kPlain, kZstd, 1, 1})
+    ->Args({kPlain, kZstd, 3, 1})
+    ->Args({kPlain, kZstd, 19, 1})
+    ->Args({kPlain, kZstd, 3, 0})
+    ->Args({kCompact, kZstd, 3, 1})
+    ->Args({kCompact, kZstd, 3, 0})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DecompressTable)
+    ->ArgNames({"format", "codec"})
+    ->Args({kPlain, kGzip})
+    ->Args({kPlain, kZstd})
+    ->Args({kCompact, kZstd})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,113 @@
+// End-to-end throughput of single_thread_runner on generated workloads: blocks are parsed,
+// executed and their binary tables are written to a temporary directory.
+
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/runner.hpp"
+#include "zkevm_framework/assigner_runner/workload_generator.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+#include "zkevm_framework/preset/preset.hpp"
+
+namespace {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+
+    constexpr std::size_t kBlocks = 4;
+    // Contract argument selecting all kinds equally
+    constexpr int kMixed = static_cast<int>(kWorkloadContractKinds);
+
+    double peak_rss_megabytes() {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        // Linux reports kilobytes
+        return static_cast<double>(usage.ru_maxrss) / 1024;
+    }
+
+    // Arguments: messages per block, contract kind or kMixed
+    void BM_EndToEnd(benchmark::State& state) {
+        workload_options options;
+        options.blocks = kBlocks;
+        options.messages_per_block = state.range(0);
+        if (state.range(1) != kMixed) {
+            options.contract_mix = {};
+            options.contract_mix[state.range(1)] = 1;
+        }
+        const auto generated = generate_workload(options);
+        const auto directory = std::filesystem::temp_directory_path() /
+                               ("zkevm_bench_e2e_" + std::to_string(state.range(0)) + "_" +
+                                std::to_string(state.range(1)));
+        if (!generated || write_workload(generated.value(), directory.string())) {
+            state.SkipWithError("Cannot generate workload");
+            return;
+        }
+
+        zkevm_circuits<ArithmetizationType> circuits;
+        std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                           nil::blueprint::assignment<ArithmetizationType>>
+            preset;
+        auto err = initialize_circuits<BlueprintFieldType>(circuits, preset);
+        single_thread_runner<BlueprintFieldType> runner(preset, 0, circuits.get_circuit_names(),
+                                                        boost::log::trivial::warning);
+        if (!err) {
+            err = runner.extract_accounts_with_storage((directory / "state.json").string());
+        }
+        if (err) {
+            state.SkipWithError(err->c_str());
+            return;
+        }
+
+        std::size_t rows = 0;
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < kBlocks && !err; i++) {
+                core::types::Block block;
+                input_messages messages;
+                block_origin origin;
+                const auto block_file = directory / ("block" + std::to_string(i) + ".json");
+                err = runner.load_block("", block_file.string(), block, messages, origin);
+                typename single_thread_runner<BlueprintFieldType>::assignments_type assignments;
+                if (!err) {
+                    err = runner.execute_block(std::move(block), std::move(messages), origin,
+                                               assignments);
+                }
+                if (!err) {
+                    err = runner.write_outputs(
+                        assignments, (directory / ("tables" + std::to_string(i))).string(), {});
+                }
+                for (const auto& [_, table] : assignments) {
+                    rows += usable_rows(table);
+                }
+            }
+            if (err) {
+                state.SkipWithError(err->c_str());
+                break;
+            }
+        }
+        std::filesystem::remove_all(directory);
+
+        const auto iterations = static_cast<double>(state.iterations());
+        state.counters["blocks"] =
+            benchmark::Counter(iterations * kBlocks, benchmark::Counter::kIsRate);
+        state.counters["messages"] =
+            benchmark::Counter(iterations * generated->messages, benchmark::Counter::kIsRate);
+        state.counters["rows"] =
+            benchmark::Counter(static_cast<double>(rows), benchmark::Counter::kIsRate);
+        state.counters["peak_rss_mb"] = peak_rss_megabytes();
+    }
+}  // namespace
+
+BENCHMARK(BM_EndToEnd)
+    ->ArgNames({"messages", "contract"})
+    ->ArgsProduct({{16, 128}, {0, 1, 2, 3, kMixed}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+// Parsing of JSON input: the example block with messages, the example account state and hex
+// strings of given size.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/block_parser.hpp"
+#include "zkevm_framework/assigner_runner/state_parser.hpp"
+#include "zkevm_framework/json_helpers/json_helpers.hpp"
+
+namespace {
+    std::string ReadFile(const char* file_name) {
+        std::ifstream in(file_name, std::ios_base::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void BM_ParseBlock(benchmark::State& state) {
+        const auto data = ReadFile(BLOCK_CONFIG);
+        for (auto _ : state) {
+            std::istringstream in(data);
+            core::types::Block block;
+            std::vector<core::types::Message> messages;
+            if (load_block_with_messages(block, messages, in)) {
+                state.SkipWithError("Cannot parse block");
+                break;
+            }
+            benchmark::DoNotOptimize(messages.data());
+        }
+        state.SetBytesProcessed(state.iterations() * data.size());
+    }
+
+    void BM_ParseState(benchmark::State& state) {
+        const auto data = ReadFile(STATE_CONFIG);
+        for (auto _ : state) {
+            std::istringstream in(data);
+            evmc::accounts accounts;
+            if (init_account_storage(accounts, in)) {
+                state.SkipWithError("Cannot parse account state");
+                break;
+            }
+            benchmark::DoNotOptimize(accounts.size());
+        }
+        state.SetBytesProcessed(state.iterations() * data.size());
+    }
+
+    // Argument: decoded bytes
+    void BM_DecodeHex(benchmark::State& state) {
+        static constexpr char kDigits[] = "0123456789abcdef";
+        std::string hex = "0x";
+        for (std::int64_t i = 0; i < state.range(0) * 2; i++) {
+            hex.push_back(kDigits[(i * 7) % 16]);
+        }
+        std::vector<std::uint8_t> bytes;
+        for (auto _ : state) {
+            // Prefix is stripped in place
+            std::string input = hex;
+            bytes.clear();
+            if (json_helpers::to_bytes(input, bytes)) {
+                state.SkipWithError("Cannot decode hex");
+                break;
+            }
+            benchmark::DoNotOptimize(bytes.data());
+        }
+        state.SetBytesProcessed(state.iterations() * hex.size());
+    }
+}  // namespace
+
+BENCHMARK(BM_ParseBlock);
+BENCHMARK(BM_ParseState);
+BENCHMARK(BM_DecodeHex)->RangeMultiplier(16)->Range(32, 32 << 12);
@@ -0,0 +1,81 @@
+// Binary serialization of a synthetic assignment table for each supported field type, in plain
+// and compact formats.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+
+namespace {
+    using Endianness = nil::marshalling::option::big_endian;
+    using PallasField = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using BlsField = typename nil::crypto3::algebra::fields::bls12_base_field<381>;
+
+    constexpr std::size_t kWitnesses = 16;
+    constexpr std::size_t kConstants = 2;
+    constexpr std::size_t kSelectors = 8;
+
+    // Witnesses are random, selectors are zeros and ones, as in circuit tables
+    template<typename BlueprintFieldType>
+    nil::blueprint::assignment<nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+    MakeTable(std::size_t rows) {
+        using value_type = typename BlueprintFieldType::value_type;
+        nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc(
+            kWitnesses, 1, kConstants, kSelectors);
+        nil::blueprint::assignment<
+            nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>>
+            table(desc);
+        std::mt19937_64 rng(rows);
+        for (std::size_t row = 0; row < rows; row++) {
+            for (std::size_t i = 0; i < kWitnesses; i++) {
+                table.witness(i, row) = value_type(rng());
+            }
+            for (std::size_t i = 0; i < kSelectors; i++) {
+                table.selector(i, row) = value_type((row >> i) & 1);
+            }
+        }
+        table.public_input(0, 0) = value_type(1);
+        table.constant(0, 0) = value_type(1);
+        return table;
+    }
+
+    // Arguments: rows, table format
+    template<typename BlueprintFieldType>
+    void BM_WriteBinaryAssignment(benchmark::State& state) {
+        using ArithmetizationType =
+            nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+        const auto table = MakeTable<BlueprintFieldType>(state.range(0));
+        const auto format = static_cast<table_format>(state.range(1));
+        std::size_t size = 0;
+        for (auto _ : state) {
+            std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+            write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+                table, 0, usable_rows(table), out, format);
+            size = static_cast<std::size_t>(out.tellp());
+            benchmark::DoNotOptimize(size);
+        }
+        state.SetBytesProcessed(state.iterations() * size);
+        state.counters["rows"] = benchmark::Counter(static_cast<double>(state.range(0)),
+                                                    benchmark::Counter::kIsIterationInvariantRate);
+        state.counters["table_bytes"] = static_cast<double>(size);
+    }
+}  // namespace
+
+constexpr int kPlain = static_cast<int>(table_format::plain);
+constexpr int kCompact = static_cast<int>(table_format::compact);
+
+BENCHMARK_TEMPLATE(BM_WriteBinaryAssignment, PallasField)
+    ->ArgNames({"rows", "format"})
+    ->ArgsProduct({{1 << 10, 1 << 14}, {kPlain, kCompact}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_WriteBinaryAssignment, BlsField)
+    ->ArgNames({"rows", "format"})
+    ->ArgsProduct({{1 << 10, 1 << 14}, {kPlain, kCompact}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,112 @@
+// Get, set and remove of the Merkle Patricia trie holding a given number of random 32-byte keys,
+// and bulk building of such trie by a given number of hashing threads.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "zkevm_framework/core/mpt/hasher.hpp"
+#include "zkevm_framework/core/mpt/mpt.hpp"
+
+using namespace core::mpt;
+
+using Bytes = std::vector<std::byte>;
+
+namespace {
+    constexpr std::size_t kKeySize = 32;
+    constexpr std::size_t kValueSize = 32;
+
+    std::vector<Bytes> MakeKeys(std::size_t count, std::uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::vector<Bytes> keys(count, Bytes(kKeySize));
+        for (auto& key : keys) {
+            for (auto& byte : key) {
+                byte = static_cast<std::byte>(rng());
+            }
+        }
+        return keys;
+    }
+
+    MerklePatriciaTrie MakeTrie(const std::vector<Bytes>& keys) {
+        MerklePatriciaTrie trie;
+        const Bytes value(kValueSize, std::byte{0xAB});
+        for (const auto& key : keys) {
+            trie.set(key, value);
+        }
+        return trie;
+    }
+}  // namespace
+
+static void BM_MptGet(benchmark::State& state) {
+    const auto keys = MakeKeys(state.range(0), state.range(0));
+    const auto trie = MakeTrie(keys);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(trie.get(keys[i]));
+        i = i + 1 == keys.size() ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_MptSet(benchmark::State& state) {
+    const auto keys = MakeKeys(state.range(0), state.range(0));
+    // Keys inserted into the trie of the given size, the trie is rebuilt when they run out
+    const auto new_keys = MakeKeys(1024, 0);
+    const Bytes value(kValueSize, std::byte{0xCD});
+    auto trie = MakeTrie(keys);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        trie.set(new_keys[i], value);
+        if (++i == new_keys.size()) {
+            state.PauseTiming();
+            trie = MakeTrie(keys);
+            i = 0;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_MptRemove(benchmark::State& state) {
+    const auto keys = MakeKeys(state.range(0), state.range(0));
+    auto trie = MakeTrie(keys);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        trie.remove(keys[i]);
+        // Removed keys are returned back, so the trie keeps its size
+        state.PauseTiming();
+        trie.set(keys[i], Bytes(kValueSize, std::byte{0xAB}));
+        i = i + 1 == keys.size() ? 0 : i + 1;
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Arguments: number of keys, hashing threads
+static void BM_MptBuild(benchmark::State& state) {
+    const auto keys = MakeKeys(state.range(0), state.range(0));
+    const auto hasher = std::make_shared<ParallelHasher>(DefaultHasher(), state.range(1));
+    for (auto _ : state) {
+        std::vector<std::pair<Bytes, Bytes>> entries;
+        entries.reserve(keys.size());
+        for (const auto& key : keys) {
+            entries.emplace_back(key, Bytes(kValueSize, std::byte{0xAB}));
+        }
+        MerklePatriciaTrie trie(hasher);
+        trie.build(std::move(entries));
+        benchmark::DoNotOptimize(trie.root());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(BM_MptGet)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_MptSet)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_MptRemove)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_MptBuild)
+    ->ArgNames({"keys", "threads"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {1, 4}})
+    ->UseRealTime();
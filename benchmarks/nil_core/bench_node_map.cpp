@@ -0,0 +1,130 @@
+// Compares node storage of the MPT: flat open-addressing map keyed by NodeKey versus
+// std::unordered_map keyed by vector of bytes (storage used before FlatNodeMap).
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "zkevm_framework/core/mpt/flat_node_map.hpp"
+#include "zkevm_framework/core/mpt/node_key.hpp"
+
+using namespace core::mpt;
+
+using Bytes = std::vector<std::byte>;
+
+namespace {
+    constexpr std::size_t kDigestSize = 64;
+    constexpr std::size_t kEncodedNodeSize = 100;
+
+    // Bytes allocated by CountingAllocator since the last reset
+    std::size_t allocated_bytes = 0;
+
+    template<typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        CountingAllocator() = default;
+        template<typename U>
+        CountingAllocator(const CountingAllocator<U>&) {}
+
+        T* allocate(std::size_t n) {
+            allocated_bytes += n * sizeof(T);
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T* p, std::size_t n) {
+            allocated_bytes -= n * sizeof(T);
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template<typename U>
+        bool operator==(const CountingAllocator<U>&) const {
+            return true;
+        }
+    };
+
+    // Hash which was used for unordered_map storage of the trie
+    struct StringViewHash {
+        std::size_t operator()(const Bytes& v) const {
+            return std::hash<std::string_view>()(
+                std::string_view(reinterpret_cast<const char*>(v.data()), v.size()));
+        }
+    };
+
+    using UnorderedNodeMap =
+        std::unordered_map<Bytes, Bytes, StringViewHash, std::equal_to<Bytes>,
+                           CountingAllocator<std::pair<const Bytes, Bytes>>>;
+    using FlatMap = FlatNodeMap<NodeKey, Bytes, NodeKeyHash>;
+
+    std::vector<Bytes> MakeDigests(std::size_t count) {
+        std::mt19937_64 rng(count);
+        std::vector<Bytes> digests(count, Bytes(kDigestSize));
+        for (auto& digest : digests) {
+            for (auto& byte : digest) {
+                byte = static_cast<std::byte>(rng());
+            }
+        }
+        return digests;
+    }
+}  // namespace
+
+static void BM_UnorderedMapLookup(benchmark::State& state) {
+    const auto digests = MakeDigests(state.range(0));
+    allocated_bytes = 0;
+    UnorderedNodeMap map;
+    for (const auto& digest : digests) {
+        map.emplace(digest, Bytes(kEncodedNodeSize));
+    }
+    // Keys are stored as separate heap buffers
+    const std::size_t memory = allocated_bytes + digests.size() * kDigestSize;
+
+    std::size_t idx = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(digests[idx]));
+        idx = (idx + 1) % digests.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_node"] = static_cast<double>(memory) / digests.size();
+}
+
+static void BM_FlatNodeMapLookup(benchmark::State& state) {
+    const auto digests = MakeDigests(state.range(0));
+    std::vector<NodeKey> keys(digests.begin(), digests.end());
+    FlatMap map;
+    for (const auto& key : keys) {
+        map.insert_or_assign(key, Bytes(kEncodedNodeSize));
+    }
+    const std::size_t memory = map.allocated_bytes();
+
+    std::size_t idx = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[idx]));
+        idx = (idx + 1) % keys.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_node"] = static_cast<double>(memory) / keys.size();
+}
+
+// Trie operations look nodes up by reference, which has to be converted into NodeKey first
+static void BM_FlatNodeMapLookupByReference(benchmark::State& state) {
+    const auto digests = MakeDigests(state.range(0));
+    FlatMap map;
+    for (const auto& digest : digests) {
+        map.insert_or_assign(NodeKey(digest), Bytes(kEncodedNodeSize));
+    }
+
+    std::size_t idx = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(NodeKey(digests[idx])));
+        idx = (idx + 1) % digests.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_UnorderedMapLookup)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_FlatNodeMapLookup)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_FlatNodeMapLookupByReference)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
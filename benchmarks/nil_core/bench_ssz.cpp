@@ -0,0 +1,125 @@
+// SSZ serialization and deserialization of blocks and messages with calldata of given size,
+// compared to reading them through views.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "ssz++.hpp"
+#include "zkevm_framework/core/hash_tree_root.hpp"
+#include "zkevm_framework/core/types/block.hpp"
+#include "zkevm_framework/core/types/message.hpp"
+#include "zkevm_framework/core/types/views.hpp"
+
+using namespace core::types;
+
+namespace {
+    Block MakeBlock() {
+        Block block{};
+        block.m_id = 42;
+        block.m_prev_block = {std::byte{0xFF}};
+        block.m_smart_contracts_root = {std::byte{0x22}};
+        block.m_in_messages_root = {std::byte{0xBB}};
+        block.m_out_messages_root = {std::byte{0xEE}};
+        block.m_out_messages_num = 43;
+        block.m_receipts_root = {std::byte{0x11}};
+        block.m_child_blocks_root_hash = {std::byte{0xAA}};
+        block.m_master_chain_hash = {std::byte{0xDD}};
+        block.m_logs_bloom = {std::byte{0xCC}};
+        block.m_timestamp = 44;
+        block.m_gasPrice = Value{.m_value = 100};
+        return block;
+    }
+
+    Message MakeMessage(std::size_t data_size) {
+        Message message{};
+        message.m_flags = 0b00000001;
+        message.m_chain_id = 42;
+        message.m_seqno = 47;
+        message.m_feeCredit = Value{.m_value = 2000000};
+        message.m_from = {std::byte{0xEE}};
+        message.m_to = {std::byte{0x22}};
+        message.m_refund_to = {std::byte{0xFF}};
+        message.m_bounce_to = {std::byte{0xFF}};
+        message.m_value = Value{.m_value = 100};
+        message.m_data = {{std::vector<std::byte>(data_size, std::byte{0xDD})}};
+        message.m_signature = {{std::vector<std::byte>(65, std::byte{0x11})}};
+        return message;
+    }
+}  // namespace
+
+static void BM_SerializeBlock(benchmark::State& state) {
+    const auto block = MakeBlock();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ssz::serialize(block));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_DeserializeBlock(benchmark::State& state) {
+    const auto bytes = ssz::serialize(MakeBlock());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ssz::deserialize<Block>(bytes));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Argument: calldata bytes
+static void BM_SerializeMessage(benchmark::State& state) {
+    const auto message = MakeMessage(state.range(0));
+    std::size_t size = 0;
+    for (auto _ : state) {
+        const auto bytes = ssz::serialize(message);
+        size = bytes.size();
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+// Argument: calldata bytes
+static void BM_DeserializeMessage(benchmark::State& state) {
+    const auto bytes = ssz::serialize(MakeMessage(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ssz::deserialize<Message>(bytes));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Argument: calldata bytes. Parses the view and reads the fields used by the runner
+static void BM_ViewMessage(benchmark::State& state) {
+    const auto bytes = ssz::serialize(MakeMessage(state.range(0)));
+    for (auto _ : state) {
+        const auto view = MessageView::parse(bytes);
+        benchmark::DoNotOptimize(view->flags());
+        benchmark::DoNotOptimize(view->from());
+        benchmark::DoNotOptimize(view->to());
+        benchmark::DoNotOptimize(view->value());
+        benchmark::DoNotOptimize(view->fee_credit());
+        benchmark::DoNotOptimize(view->data().data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Arguments: messages with 256 bytes of calldata, threads
+static void BM_MessagesRoot(benchmark::State& state) {
+    const std::vector<Message> messages(state.range(0), MakeMessage(256));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(core::messages_root(messages, state.range(1)));
+    }
+    state.SetItemsProcessed(state.iterations() * messages.size());
+}
+
+BENCHMARK(BM_SerializeBlock);
+BENCHMARK(BM_DeserializeBlock);
+BENCHMARK(BM_SerializeMessage)->RangeMultiplier(16)->Range(0, 16384);
+BENCHMARK(BM_DeserializeMessage)->RangeMultiplier(16)->Range(0, 16384);
+BENCHMARK(BM_ViewMessage)->RangeMultiplier(16)->Range(0, 16384);
+BENCHMARK(BM_MessagesRoot)
+    ->ArgNames({"messages", "threads"})
+    ->ArgsProduct({{256, 4096}, {1, 4}})
+    ->UseRealTime();
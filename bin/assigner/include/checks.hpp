@@ -7,10 +7,23 @@
 #ifndef ZKEMV_FRAMEWORK_LIBS_CHECKS_INCLUDE_CHECKS_HPP_
 #define ZKEMV_FRAMEWORK_LIBS_CHECKS_INCLUDE_CHECKS_HPP_
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
 #include <nil/blueprint/blueprint/plonk/assignment.hpp>
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 #include <nil/blueprint/utils/connectedness_check.hpp>
 #include <nil/blueprint/utils/satisfiability_check.hpp>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 template<typename BlueprintFieldType>
 using ArithmetizationType = nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
@@ -67,4 +80,216 @@ bool is_satisfied(
     return true;
 }
 
+struct satisfiability_check_options {
+    /// @brief Number of checking threads, 0 means hardware concurrency
+    std::size_t threads = 0;
+    /// @brief Rows checked by one task
+    std::size_t block_rows = 1024;
+    /// @brief Check only randomly sampled rows and copy constraints
+    bool sampled = false;
+    /// @brief Probability to detect a table with at least `fault_rate` share of broken rows
+    double confidence = 0.99;
+    double fault_rate = 0.01;
+    /// @brief Seed of row sampling, 0 means random
+    std::uint64_t seed = 0;
+};
+
+struct satisfiability_failure {
+    /// @brief "gate", "lookup gate" or "copy constraint"
+    std::string kind;
+    /// @brief Index of the gate or of the copy constraint
+    std::size_t index = 0;
+    /// @brief Index of the constraint inside the gate
+    std::optional<std::size_t> constraint;
+    /// @brief Failed row of a gate or of a lookup gate
+    std::size_t row = 0;
+
+    std::string to_string() const {
+        std::string result = kind + " " + std::to_string(index);
+        if (constraint) {
+            result += " constraint " + std::to_string(*constraint);
+        }
+        if (kind == "copy constraint") {
+            return result;
+        }
+        return result + " on row " + std::to_string(row);
+    }
+};
+
+struct satisfiability_report {
+    std::optional<satisfiability_failure> failure;
+    std::size_t rows_checked = 0;
+    std::size_t copy_constraints_checked = 0;
+
+    bool is_satisfied() const { return !failure.has_value(); }
+};
+
+/**
+ * @brief Number of uniformly sampled rows detecting a table where at least `fault_rate` share
+ * of rows is broken with probability `confidence`.
+ */
+inline std::size_t satisfiability_sample_size(double confidence, double fault_rate) {
+    if (confidence <= 0 || fault_rate >= 1) {
+        return 1;
+    }
+    if (confidence >= 1 || fault_rate <= 0) {
+        return std::numeric_limits<std::size_t>::max();
+    }
+    return static_cast<std::size_t>(std::ceil(std::log1p(-confidence) / std::log1p(-fault_rate)));
+}
+
+namespace details {
+    // Sorted distinct indices from [0, total)
+    inline std::vector<std::size_t> sample_indices(std::size_t total, std::size_t count,
+                                                   std::mt19937_64& gen) {
+        std::vector<std::size_t> result;
+        if (count >= total) {
+            result.resize(total);
+            std::iota(result.begin(), result.end(), 0);
+            return result;
+        }
+        std::set<std::size_t> sampled;
+        std::uniform_int_distribution<std::size_t> dist(0, total - 1);
+        while (sampled.size() < count) {
+            sampled.insert(dist(gen));
+        }
+        return {sampled.begin(), sampled.end()};
+    }
+}  // namespace details
+
+/**
+ * @brief Check gates, lookup gates and copy constraints of the circuit on blocks of rows in
+ * parallel. Checking stops soon after the first failure. Reported failure doesn't depend on the
+ * number of threads: it is the one on the first failing row, gates before lookup gates on the
+ * same row, copy constraints are reported only if all rows are satisfied. In sampled mode only
+ * random rows and copy constraints are checked, the number of samples follows from the
+ * confidence options.
+ */
+template<typename BlueprintFieldType>
+satisfiability_report check_satisfiability(
+    const nil::blueprint::circuit<ArithmetizationType<BlueprintFieldType>>& bp,
+    const nil::blueprint::assignment<ArithmetizationType<BlueprintFieldType>>& assignment,
+    const satisfiability_check_options& options = {}) {
+    using assignment_table_type =
+        nil::crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType>;
+
+    const auto& gates = bp.gates();
+    const auto& copy_constraints = bp.copy_constraints();
+    const auto& lookup_gates = bp.lookup_gates();
+
+    std::mt19937_64 gen(options.seed != 0 ? options.seed : std::random_device{}());
+    const std::size_t samples =
+        options.sampled ? satisfiability_sample_size(options.confidence, options.fault_rate)
+                        : std::numeric_limits<std::size_t>::max();
+    const auto rows = details::sample_indices(assignment.rows_amount(), samples, gen);
+    const auto copies = details::sample_indices(copy_constraints.size(), samples, gen);
+
+    // Lookups of the gate on rows [begin, end) of the checked ones
+    auto lookup_satisfied = [&](std::uint32_t gate, std::size_t begin, std::size_t end) {
+        const std::set<std::uint32_t> selector_rows(rows.begin() + begin, rows.begin() + end);
+        return nil::blueprint::is_satisfied(bp, assignment, {}, {gate}, {}, selector_rows);
+    };
+
+    // Tasks are row blocks followed by copy constraint blocks
+    const std::size_t block = std::max<std::size_t>(options.block_rows, 1);
+    const std::size_t row_tasks = (rows.size() + block - 1) / block;
+    const std::size_t tasks = row_tasks + (copies.size() + block - 1) / block;
+
+    satisfiability_report report;
+    report.rows_checked = rows.size();
+    report.copy_constraints_checked = copies.size();
+    // Failures are ordered by task, tasks following a failed one are skipped, preceding ones
+    // are completed as they may fail on earlier rows
+    std::mutex failure_mutex;
+    std::atomic<std::size_t> failed_task = tasks;
+    auto fail = [&](std::size_t task, satisfiability_failure failure) {
+        std::lock_guard<std::mutex> lock(failure_mutex);
+        if (task < failed_task) {
+            report.failure = std::move(failure);
+            failed_task = task;
+        }
+    };
+
+    auto check_rows = [&](std::size_t task, std::size_t begin, std::size_t end) {
+        // Rows after a failed one are not checked by the following gates
+        std::size_t failed_row = end;
+        std::optional<satisfiability_failure> failure;
+        for (std::size_t i = 0; i < gates.size() && task < failed_task; i++) {
+            const auto& selector =
+                assignment.assignment_table_type::selector(gates[i].selector_index);
+            for (std::size_t r = begin; r < failed_row; r++) {
+                const auto row = rows[r];
+                if (row >= selector.size() || selector[row].is_zero()) {
+                    continue;
+                }
+                for (std::size_t j = 0; j < gates[i].constraints.size() && r < failed_row; j++) {
+                    if (!gates[i].constraints[j].evaluate(row, assignment).is_zero()) {
+                        failure = satisfiability_failure{"gate", i, j, row};
+                        failed_row = r;
+                    }
+                }
+            }
+        }
+        // Lookup gates are checked one by one on rows before the failed one. A failing gate is
+        // narrowed down to its first failing row by bisection: rows [begin, low) are satisfied,
+        // rows [begin, high) are not
+        for (std::uint32_t i = 0; i < lookup_gates.size() && task < failed_task; i++) {
+            if (failed_row == begin || lookup_satisfied(i, begin, failed_row)) {
+                continue;
+            }
+            std::size_t low = begin;
+            std::size_t high = failed_row;
+            while (high - low > 1) {
+                const std::size_t middle = low + (high - low) / 2;
+                if (lookup_satisfied(i, begin, middle)) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+            failure = satisfiability_failure{"lookup gate", i, std::nullopt, rows[low]};
+            failed_row = low;
+        }
+        if (failure) {
+            fail(task, std::move(*failure));
+        }
+    };
+
+    auto check_copies = [&](std::size_t task, std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end && task < failed_task; c++) {
+            const auto& constraint = copy_constraints[copies[c]];
+            if (nil::blueprint::var_value(assignment, constraint.first) !=
+                nil::blueprint::var_value(assignment, constraint.second)) {
+                fail(task, {"copy constraint", copies[c], std::nullopt, 0});
+                return;
+            }
+        }
+    };
+
+    std::atomic<std::size_t> next = 0;
+    auto worker = [&] {
+        // Tasks are taken in order, so the ones left after a failure follow it
+        for (auto task = next++; task < tasks && task < failed_task; task = next++) {
+            if (task < row_tasks) {
+                check_rows(task, task * block, std::min(rows.size(), (task + 1) * block));
+            } else {
+                const auto begin = (task - row_tasks) * block;
+                check_copies(task, begin, std::min(copies.size(), begin + block));
+            }
+        }
+    };
+    const std::size_t threads =
+        options.threads != 0 ? options.threads
+                             : std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 1; t < std::min(threads, tasks); ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& w : workers) {
+        w.join();
+    }
+    return report;
+}
+
 #endif  // ZKEMV_FRAMEWORK_LIBS_CHECKS_INCLUDE_CHECKS_HPP_
@@ -0,0 +1,441 @@
+/**
+ * @file daemon.hpp
+ *
+ * @brief Long-running assigner serving assignment jobs over local HTTP or Unix domain socket.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_BIN_ASSIGNER_INCLUDE_DAEMON_HPP_
+#define ZKEMV_FRAMEWORK_BIN_ASSIGNER_INCLUDE_DAEMON_HPP_
+
+#include <httplib.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <boost/json/object.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/log/trivial.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "checks.hpp"
+#include "zkevm_framework/assigner_runner/profiler.hpp"
+#include "zkevm_framework/assigner_runner/runner.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+#include "zkevm_framework/preset/preset.hpp"
+
+struct daemon_options {
+    /// @brief Path of Unix domain socket, if empty the daemon listens on host:port
+    std::string unix_socket;
+    std::string host = "127.0.0.1";
+    int port = 8530;
+    /// @brief Max number of jobs executed concurrently
+    std::size_t max_jobs = 1;
+    /// @brief Node queried for blocks and accounts of jobs
+    rpc_endpoint rpc;
+    /// @brief Directory which paths of jobs are relative to, jobs can't access files outside of it
+    std::string work_directory = ".";
+    /// @brief Token expected in `Authorization: Bearer <token>` header of shutdown requests.
+    /// If empty, shutdown requests are rejected and the daemon is stopped by a signal
+    std::string shutdown_token;
+    /// @brief Check input messages of every job against the messages root of its block header
+    bool check_messages_root = false;
+    /// @brief Fail a job if some of its tables needs more rows
+    std::optional<std::size_t> max_rows;
+    /// @brief Binary table output options of every job
+    table_output_options table;
+    /// @brief Satisfiability check of the bytecode table of every job
+    satisfiability_check_options check;
+    /// @brief Format of profiles requested by jobs
+    profiler::output_format profile_format = profiler::output_format::json;
+};
+
+/// @brief Assigner daemon keeping circuits and runner caches warm between jobs.
+///
+/// Circuits are preset once. Every concurrent job slot owns a runner with its own copy of the
+/// preset tables, so the code cache of the runner survives between jobs. Jobs over
+/// the limit wait for a free slot and are reported as queued.
+///
+/// Jobs write binary tables only, readable text output is not supported. Messages root check
+/// and row limit of the options apply to every job.
+///
+/// File paths of jobs are relative to the work directory and must stay inside of it. Bytecode
+/// table of every job is checked for satisfiability, the result is reported in the response.
+///
+/// Endpoints:
+///   POST /jobs     {"block_file" | "block_hash", "account_storage"?, "assignment_tables",
+///                   "profile"?}
+///   GET  /metrics  queue depth, job counters and latencies
+///   GET  /health
+///   POST /shutdown requires `Authorization: Bearer <shutdown_token>` header
+template<typename BlueprintFieldType>
+class assigner_daemon {
+  public:
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using assignments_type = typename single_thread_runner<BlueprintFieldType>::assignments_type;
+
+    assigner_daemon(daemon_options options, uint64_t shard_id,
+                    const std::vector<std::string>& target_circuits, bool lazy_storage,
+                    boost::log::trivial::severity_level log_level)
+        : m_options(std::move(options)),
+          m_shard_id(shard_id),
+          m_target_circuits(target_circuits),
+          m_lazy_storage(lazy_storage),
+          m_log_level(log_level) {}
+
+    /// @brief Preset circuits and start serving jobs, returns when the daemon is stopped
+    std::optional<std::string> run() {
+        if (m_workers.empty()) {
+            auto err = init();
+            if (err) {
+                return err;
+            }
+        }
+
+        // Keep a few handler threads for metrics requests while all job slots are busy
+        const std::size_t threads = std::max<std::size_t>(m_options.max_jobs * 2, 4);
+        m_server.new_task_queue = [threads] { return new httplib::ThreadPool(threads); };
+
+        m_server.Post("/jobs", [this](const httplib::Request& req, httplib::Response& res) {
+            handle_job(req, res);
+        });
+        m_server.Get("/metrics", [this](const httplib::Request&, httplib::Response& res) {
+            res.set_content(boost::json::serialize(metrics()), "application/json");
+        });
+        m_server.Get("/health", [](const httplib::Request&, httplib::Response& res) {
+            res.set_content("ok", "text/plain");
+        });
+        m_server.Post("/shutdown", [this](const httplib::Request& req, httplib::Response& res) {
+            handle_shutdown(req, res);
+        });
+
+        bool listening = false;
+        if (!m_options.unix_socket.empty()) {
+            BOOST_LOG_TRIVIAL(info) << "Assigner daemon listens on " << m_options.unix_socket;
+            m_server.set_address_family(AF_UNIX);
+            listening = m_server.listen(m_options.unix_socket, 80);
+        } else {
+            BOOST_LOG_TRIVIAL(info) << "Assigner daemon listens on " << m_options.host << ":"
+                                    << m_options.port;
+            listening = m_server.listen(m_options.host, m_options.port);
+        }
+        if (!listening && !m_stopped) {
+            return "Could not listen on " + (m_options.unix_socket.empty()
+                                                 ? m_options.host + ":" +
+                                                       std::to_string(m_options.port)
+                                                 : m_options.unix_socket);
+        }
+        return {};
+    }
+
+    void stop() {
+        m_stopped = true;
+        m_server.stop();
+    }
+
+    /// @brief Resolve the work directory and preset circuits, done by `run` if not called before
+    std::optional<std::string> init() {
+        std::error_code ec;
+        m_work_directory = std::filesystem::canonical(m_options.work_directory, ec);
+        if (ec || !std::filesystem::is_directory(m_work_directory)) {
+            return "Work directory " + m_options.work_directory + " does not exist";
+        }
+        m_circuits.m_names = m_target_circuits;
+        assignments_type preset;
+        auto err = initialize_circuits<BlueprintFieldType>(m_circuits, preset);
+        if (err) {
+            return "Preset step failed: " + err.value();
+        }
+        const auto circuit_names = m_circuits.get_circuit_names();
+        for (std::size_t i = 0; i < std::max<std::size_t>(m_options.max_jobs, 1); ++i) {
+            auto w = std::make_unique<worker>();
+            w->assignments = preset;
+            w->runner = std::make_unique<single_thread_runner<BlueprintFieldType>>(
+                w->assignments, m_shard_id, circuit_names, m_log_level);
+            w->runner->set_lazy_storage(m_lazy_storage);
+            w->runner->set_rpc_endpoint(m_options.rpc);
+            w->runner->set_table_output_options(m_options.table);
+            w->runner->set_check_messages_root(m_options.check_messages_root);
+            w->runner->set_max_rows(m_options.max_rows);
+            m_free_workers.push_back(w.get());
+            m_workers.push_back(std::move(w));
+        }
+        return {};
+    }
+
+    /// @brief Handlers of endpoints, exposed for serving without a socket
+    void handle_job(const httplib::Request& req, httplib::Response& res) {
+        using clock = std::chrono::steady_clock;
+        auto to_ms = [](clock::duration d) {
+            return std::chrono::duration<double, std::milli>(d).count();
+        };
+
+        job j;
+        auto err = parse_job(req.body, j);
+        if (!err) {
+            err = resolve_job_paths(j);
+        }
+        if (err) {
+            res.status = 400;
+            res.set_content(boost::json::serialize(boost::json::object{{"error", err.value()}}),
+                            "application/json");
+            return;
+        }
+
+        boost::json::object response;
+        const auto received = clock::now();
+        auto* w = acquire_worker();
+        const auto started = clock::now();
+        err = execute_job(*w, j, response);
+        const auto finished = clock::now();
+        release_worker(w, err.has_value(), to_ms(started - received), to_ms(finished - started));
+
+        response["queue_wait_ms"] = to_ms(started - received);
+        response["duration_ms"] = to_ms(finished - started);
+        if (err) {
+            BOOST_LOG_TRIVIAL(error) << "Job failed: " << err.value();
+            res.status = 500;
+            response["error"] = err.value();
+        } else {
+            response["status"] = "ok";
+        }
+        res.set_content(boost::json::serialize(response), "application/json");
+    }
+
+    void handle_shutdown(const httplib::Request& req, httplib::Response& res) {
+        if (m_options.shutdown_token.empty() ||
+            req.get_header_value("Authorization") != "Bearer " + m_options.shutdown_token) {
+            res.status = 403;
+            res.set_content(boost::json::serialize(
+                                boost::json::object{{"error", "Shutdown is not authorized"}}),
+                            "application/json");
+            return;
+        }
+        res.set_content("ok", "text/plain");
+        stop();
+    }
+
+    /// @brief Current queue depth, job counters and latencies
+    boost::json::object metrics() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        boost::json::object result;
+        result["max_jobs"] = m_options.max_jobs;
+        result["jobs_running"] = m_workers.size() - m_free_workers.size();
+        result["jobs_queued"] = m_queued;
+        result["jobs_completed"] = m_completed;
+        result["jobs_failed"] = m_failed;
+        const auto finished = m_completed + m_failed;
+        boost::json::object latency;
+        latency["last_ms"] = m_last_latency_ms;
+        latency["mean_ms"] = finished == 0 ? 0.0 : m_total_latency_ms / finished;
+        latency["max_ms"] = m_max_latency_ms;
+        result["latency"] = std::move(latency);
+        boost::json::object queue_wait;
+        queue_wait["mean_ms"] = finished == 0 ? 0.0 : m_total_wait_ms / finished;
+        queue_wait["max_ms"] = m_max_wait_ms;
+        result["queue_wait"] = std::move(queue_wait);
+        return result;
+    }
+
+  private:
+    struct worker {
+        assignments_type assignments;
+        std::unique_ptr<single_thread_runner<BlueprintFieldType>> runner;
+    };
+
+    struct job {
+        std::string block_hash;
+        std::string block_file;
+        std::string account_storage;
+        std::string assignment_tables;
+        std::string profile;
+    };
+
+    static std::optional<std::string> parse_job(const std::string& body, job& result) {
+        boost::json::error_code ec;
+        auto value = boost::json::parse(body, ec);
+        if (ec || !value.is_object()) {
+            return "Job must be a JSON object";
+        }
+        const auto& object = value.as_object();
+        auto get_string = [&](const char* key, std::string& out) -> std::optional<std::string> {
+            if (const auto* field = object.if_contains(key)) {
+                if (!field->is_string()) {
+                    return std::string("Job field '") + key + "' must be a string";
+                }
+                out = field->as_string().c_str();
+            }
+            return {};
+        };
+        const std::pair<const char*, std::string*> fields[] = {
+            {"block_hash", &result.block_hash},
+            {"block_file", &result.block_file},
+            {"account_storage", &result.account_storage},
+            {"assignment_tables", &result.assignment_tables},
+            {"profile", &result.profile}};
+        for (const auto& [key, out] : fields) {
+            auto err = get_string(key, *out);
+            if (err) {
+                return err;
+            }
+        }
+        if (result.block_file.empty() && result.block_hash.empty()) {
+            return "block_file or block_hash must be specified";
+        }
+        if (result.assignment_tables.empty()) {
+            return "assignment_tables must be specified";
+        }
+        return {};
+    }
+
+    // Paths must stay inside the work directory after resolving `..` and symbolic links
+    std::optional<std::string> resolve_path(std::string& path) const {
+        if (path.empty()) {
+            return {};
+        }
+        const std::filesystem::path relative(path);
+        if (relative.is_absolute()) {
+            return "Path " + path + " must be relative to the work directory";
+        }
+        std::error_code ec;
+        const auto resolved = std::filesystem::weakly_canonical(m_work_directory / relative, ec);
+        if (ec) {
+            return "Cannot resolve path " + path + ": " + ec.message();
+        }
+        const auto [dir_end, _] = std::mismatch(m_work_directory.begin(), m_work_directory.end(),
+                                                resolved.begin(), resolved.end());
+        if (dir_end != m_work_directory.end() || resolved == m_work_directory) {
+            return "Path " + path + " is outside of the work directory";
+        }
+        path = resolved.string();
+        return {};
+    }
+
+    std::optional<std::string> resolve_job_paths(job& j) const {
+        for (auto* path : {&j.block_file, &j.account_storage, &j.assignment_tables, &j.profile}) {
+            auto err = resolve_path(*path);
+            if (err) {
+                return err;
+            }
+        }
+        return {};
+    }
+
+    worker* acquire_worker() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_queued;
+        m_worker_released.wait(lock, [this] { return !m_free_workers.empty(); });
+        --m_queued;
+        auto* w = m_free_workers.back();
+        m_free_workers.pop_back();
+        return w;
+    }
+
+    void release_worker(worker* w, bool failed, double wait_ms, double latency_ms) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free_workers.push_back(w);
+        ++(failed ? m_failed : m_completed);
+        m_last_latency_ms = latency_ms;
+        m_total_latency_ms += latency_ms;
+        m_max_latency_ms = std::max(m_max_latency_ms, latency_ms);
+        m_total_wait_ms += wait_ms;
+        m_max_wait_ms = std::max(m_max_wait_ms, wait_ms);
+        m_worker_released.notify_one();
+    }
+
+    std::optional<std::string> execute_job(worker& w, const job& j,
+                                           boost::json::object& response) {
+        profiler prof;
+        w.runner->set_profiler(j.profile.empty() ? nullptr : &prof);
+        auto err = run_job(w, j, response);
+        w.runner->set_profiler(nullptr);
+        if (!err && !j.profile.empty()) {
+            err = prof.dump(j.profile, m_options.profile_format);
+            if (err) {
+                return "Write profile failed: " + err.value();
+            }
+        }
+        return err;
+    }
+
+    std::optional<std::string> run_job(worker& w, const job& j, boost::json::object& response) {
+        auto& runner = *w.runner;
+        // Accounts of the previous job must not leak into this one, caches are kept
+        runner.reset_account_storage();
+        auto err = runner.extract_accounts_with_storage(j.account_storage);
+        if (err) {
+            return "Extract account storage failed: " + err.value();
+        }
+        core::types::Block block;
+        input_messages messages;
+        block_origin origin;
+        err = runner.load_block(j.block_hash, j.block_file, block, messages, origin);
+        if (err) {
+            return "Extract input block failed: " + err.value();
+        }
+        assignments_type tables;
+        err = runner.execute_block(std::move(block), std::move(messages), origin, tables);
+        if (err) {
+            return "Assigner run failed: " + err.value();
+        }
+        err = runner.write_outputs(tables, j.assignment_tables, std::nullopt);
+        if (err) {
+            return err;
+        }
+
+        // Unsatisfied table is reported but not treated as a failure, like in a single run
+        auto it = tables.find(nil::evm_assigner::zkevm_circuit::BYTECODE);
+        if (it != tables.end()) {
+            auto check_timer = prof_scope(runner.get_profiler(), "satisfiability_check");
+            const auto report = check_satisfiability<BlueprintFieldType>(
+                m_circuits.m_bytecode_circuit, it->second, m_options.check);
+            response["satisfied"] = report.is_satisfied();
+            if (!report.is_satisfied()) {
+                response["check_failure"] = report.failure->to_string();
+            }
+        }
+        return {};
+    }
+
+    static profiler::scoped_timer prof_scope(profiler* prof, std::string name) {
+        if (prof == nullptr) {
+            return {};
+        }
+        return prof->scope(std::move(name));
+    }
+
+    daemon_options m_options;
+    uint64_t m_shard_id;
+    std::vector<std::string> m_target_circuits;
+    bool m_lazy_storage;
+    boost::log::trivial::severity_level m_log_level;
+    std::filesystem::path m_work_directory;
+    zkevm_circuits<ArithmetizationType> m_circuits;
+    httplib::Server m_server;
+    std::atomic<bool> m_stopped = false;
+
+    std::vector<std::unique_ptr<worker>> m_workers;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_worker_released;
+    std::vector<worker*> m_free_workers;
+    std::size_t m_queued = 0;
+    std::size_t m_completed = 0;
+    std::size_t m_failed = 0;
+    double m_last_latency_ms = 0;
+    double m_total_latency_ms = 0;
+    double m_max_latency_ms = 0;
+    double m_total_wait_ms = 0;
+    double m_max_wait_ms = 0;
+};
+
+#endif  // ZKEMV_FRAMEWORK_BIN_ASSIGNER_INCLUDE_DAEMON_HPP_
@@ -0,0 +1,56 @@
+// Global allocation functions advancing allocation counter of the calling thread used by the
+// profiler
+
+#include <cstdlib>
+#include <new>
+
+#include "zkevm_framework/assigner_runner/profiler.hpp"
+
+namespace {
+    void* counted_alloc(std::size_t size) {
+        allocation_counter() += size;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* counted_aligned_alloc(std::size_t size, std::align_val_t align) {
+        allocation_counter() += size;
+        const auto alignment = static_cast<std::size_t>(align);
+        // aligned_alloc requires size to be a multiple of alignment
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = counted_alloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    if (void* ptr = counted_aligned_alloc(size, align)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return operator new(size, align);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
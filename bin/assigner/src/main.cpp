@@ -1,8 +1,10 @@
 #include <expected>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <optional>
+#include <sstream>
 #include <string>
 
 #ifndef BOOST_FILESYSTEM_NO_DEPRECATED
@@ -25,66 +27,264 @@
 #include <unordered_map>
 
 #include "checks.hpp"
+#include "daemon.hpp"
+#include "zkevm_framework/assigner_runner/pipeline.hpp"
+#include "zkevm_framework/assigner_runner/profiler.hpp"
 #include "zkevm_framework/assigner_runner/runner.hpp"
+#include "zkevm_framework/assigner_runner/table_digest.hpp"
 #include "zkevm_framework/preset/preset.hpp"
 
+/// @brief Options of an assigner run over one or a sequence of blocks
+struct assigner_options {
+    uint64_t shard_id = 0;
+    std::vector<block_source> blocks;
+    std::string account_storage_file_name;
+    std::string assignment_table_file_name;
+    std::optional<OutputArtifacts> artifacts;
+    std::vector<std::string> target_circuits;
+    bool lazy_storage = false;
+    std::string profile_file_name;
+    profiler::output_format profile_format = profiler::output_format::json;
+    pipeline_options pipeline;
+    satisfiability_check_options check;
+    std::optional<std::size_t> max_rows;
+    table_output_options table;
+    /// @brief Base name of digest manifests to compare tables with, empty if not compared
+    std::string verify_digest_base;
+    std::string write_block_roots_file;
+    std::string verify_block_roots_file;
+    bool check_messages_root = false;
+    rpc_endpoint rpc;
+    boost::log::trivial::severity_level log_level = boost::log::trivial::info;
+};
+
+/// @brief Check if bytecode table is satisfied to the bytecode constraints.
+/// Unsatisfied table is reported but not treated as a failure for now
+template<typename BlueprintFieldType, typename CircuitsType, typename AssignmentsType>
+std::optional<std::string> check_bytecode_table(const CircuitsType& circuits,
+                                                const AssignmentsType& assignments,
+                                                const satisfiability_check_options& check_opts,
+                                                profiler& prof, const std::string& block_name) {
+    auto it = assignments.find(nil::evm_assigner::zkevm_circuit::BYTECODE);
+    if (it == assignments.end()) {
+        return "Can't find bytecode assignment table";
+    }
+    auto check_timer = prof.scope("satisfiability_check" + block_name);
+    const auto report = check_satisfiability<BlueprintFieldType>(circuits.m_bytecode_circuit,
+                                                                 it->second, check_opts);
+    check_timer.add_counter("rows_checked", static_cast<std::int64_t>(report.rows_checked));
+    check_timer.add_counter("copy_constraints_checked",
+                            static_cast<std::int64_t>(report.copy_constraints_checked));
+    check_timer.add_counter("sampled", check_opts.sampled);
+    check_timer.stop();
+
+    if (!report.is_satisfied()) {
+        std::cerr << "Bytecode table" << block_name
+                  << " is not satisfied: " << report.failure->to_string() << std::endl;
+    }
+    return {};
+}
+
+/// @brief Compare tables with digest manifests `<manifest_base>.N.digest.json` written by
+/// --write-digest, differing columns and rows are reported
+template<typename BlueprintFieldType, typename AssignmentsType>
+std::optional<std::string> verify_table_digests(const AssignmentsType& assignments,
+                                                const std::string& manifest_base,
+                                                profiler& prof) {
+    auto verify_timer = prof.scope("verify_digest " + manifest_base);
+    bool matches = true;
+    for (const auto& [circuit, table] : assignments) {
+        const auto manifest_name =
+            digest_manifest_name(manifest_base + "." + std::to_string(circuit));
+        std::ifstream manifest(manifest_name);
+        if (!manifest.is_open()) {
+            return "Cannot open digest manifest " + manifest_name;
+        }
+        std::stringstream content;
+        content << manifest.rdbuf();
+        table_digest expected;
+        auto err = table_digest::from_json(content.str(), expected);
+        if (err) {
+            return manifest_name + ": " + err.value();
+        }
+        // Chunks of the reference are used to locate differing rows
+        const auto differences =
+            compute_table_digest<BlueprintFieldType>(table, {.chunk_rows = expected.chunk_rows})
+                .compare(expected);
+        for (const auto& difference : differences) {
+            std::cerr << "Table " << circuit << " differs from " << manifest_name << ": "
+                      << difference << std::endl;
+        }
+        matches = matches && differences.empty();
+    }
+    if (!matches) {
+        return "Assignment tables differ from digest manifests " + manifest_base +
+               ".N.digest.json";
+    }
+    BOOST_LOG_TRIVIAL(info) << "Assignment tables match digest manifests " << manifest_base
+                            << ".N.digest.json";
+    return {};
+}
+
 template<typename BlueprintFieldType>
-int curve_dependent_main(uint64_t shardId, const std::string& blockHash,
-                         const std::string& block_file_name,
-                         const std::string& account_storage_file_name,
-                         const std::string& assignment_table_file_name,
-                         const std::optional<OutputArtifacts>& artifacts,
-                         const std::vector<std::string>& target_circuits,
-                         boost::log::trivial::severity_level log_level) {
+int curve_dependent_main(const assigner_options& opts) {
     using ArithmetizationType =
         nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
 
-    boost::log::core::get()->set_filter(boost::log::trivial::severity >= log_level);
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >= opts.log_level);
 
     zkevm_circuits<ArithmetizationType> circuits;
-    circuits.m_names = target_circuits;
+    circuits.m_names = opts.target_circuits;
 
     std::unordered_map<nil::evm_assigner::zkevm_circuit,
                        nil::blueprint::assignment<ArithmetizationType>>
         assignments;
 
+    profiler prof;
+    auto preset_timer = prof.scope("initialize_circuits");
     auto err = initialize_circuits<BlueprintFieldType>(circuits, assignments);
     if (err) {
         std::cerr << "Preset step failed: " << err.value() << std::endl;
         return 1;
     }
+    preset_timer.stop();
+
+    single_thread_runner<BlueprintFieldType> runner(assignments, opts.shard_id,
+                                                    circuits.get_circuit_names(), opts.log_level);
+    runner.set_lazy_storage(opts.lazy_storage);
+    runner.set_check_messages_root(opts.check_messages_root);
+    runner.set_rpc_endpoint(opts.rpc);
+    runner.set_max_rows(opts.max_rows);
+    runner.set_table_output_options(opts.table);
+    if (!opts.profile_file_name.empty()) {
+        runner.set_profiler(&prof);
+    }
 
-    single_thread_runner<BlueprintFieldType> runner(assignments, shardId,
-                                                    circuits.get_circuit_names(), log_level);
-
-    err = runner.extract_block_with_messages(blockHash, block_file_name);
+    err = runner.extract_accounts_with_storage(opts.account_storage_file_name);
     if (err) {
-        std::cerr << "Extract input block failed: " << err.value() << std::endl;
+        std::cerr << "Extract account storage failed: " << err.value() << std::endl;
         return 1;
     }
 
-    err = runner.extract_accounts_with_storage(account_storage_file_name);
+    if (!opts.verify_block_roots_file.empty()) {
+        std::ifstream manifest(opts.verify_block_roots_file);
+        if (!manifest.is_open()) {
+            std::cerr << "Cannot open block roots manifest " << opts.verify_block_roots_file
+                      << std::endl;
+            return 1;
+        }
+        std::stringstream content;
+        content << manifest.rdbuf();
+        std::vector<block_roots> expected;
+        err = block_roots_from_json(content.str(), expected);
+        if (err) {
+            std::cerr << opts.verify_block_roots_file << ": " << err.value() << std::endl;
+            return 1;
+        }
+        runner.set_expected_block_roots(std::move(expected));
+    }
+    runner.set_record_block_roots(!opts.write_block_roots_file.empty());
+    auto write_block_roots = [&]() -> bool {
+        if (opts.write_block_roots_file.empty()) {
+            return true;
+        }
+        std::ofstream out(opts.write_block_roots_file, std::ios_base::out | std::ios_base::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Cannot write block roots manifest " << opts.write_block_roots_file
+                      << std::endl;
+            return false;
+        }
+        out << block_roots_to_json(runner.get_block_roots());
+        return true;
+    };
+
+    if (opts.blocks.size() > 1) {
+        block_pipeline<BlueprintFieldType> pipeline(runner, opts.pipeline);
+        pipeline.set_table_check([&](std::size_t index, const auto& tables) {
+            // Manifests of a sequence are written per block, see `block_file_name`
+            if (!opts.verify_digest_base.empty()) {
+                auto err = verify_table_digests<BlueprintFieldType>(
+                    tables, block_pipeline<BlueprintFieldType>::block_file_name(
+                                opts.verify_digest_base, index),
+                    prof);
+                if (err) {
+                    return err;
+                }
+            }
+            return check_bytecode_table<BlueprintFieldType>(circuits, tables, opts.check, prof,
+                                                            " of block " + std::to_string(index));
+        });
+        err = pipeline.run(opts.blocks, opts.assignment_table_file_name, opts.artifacts);
+        if (err.has_value()) {
+            std::cerr << "Assigner run failed: " << err.value() << std::endl;
+            return 1;
+        }
+        if (!write_block_roots()) {
+            return 1;
+        }
+        if (!opts.profile_file_name.empty()) {
+            err = prof.dump(opts.profile_file_name, opts.profile_format);
+            if (err) {
+                std::cerr << "Write profile failed: " << err.value() << std::endl;
+                return 1;
+            }
+        }
+        // Tables of each block are moved out to the pipeline and released after writing
+        return 0;
+    }
+
+    err = runner.extract_block_with_messages(opts.blocks.front().hash,
+                                             opts.blocks.front().file_name);
     if (err) {
-        std::cerr << "Extract account storage failed: " << err.value() << std::endl;
+        std::cerr << "Extract input block failed: " << err.value() << std::endl;
         return 1;
     }
 
-    err = runner.run(assignment_table_file_name, artifacts);
+    err = runner.run(opts.assignment_table_file_name, opts.artifacts);
     if (err.has_value()) {
         std::cerr << "Assigner run failed: " << err.value() << std::endl;
         return 1;
     }
+    if (!write_block_roots()) {
+        return 1;
+    }
 
-    // Check if bytecode table is satisfied to the bytecode constraints
-    auto it = assignments.find(nil::evm_assigner::zkevm_circuit::BYTECODE);
-    if (it == assignments.end()) {
-        std::cerr << "Can;t find bytecode assignment table\n";
+    if (!opts.verify_digest_base.empty()) {
+        err = verify_table_digests<BlueprintFieldType>(assignments, opts.verify_digest_base, prof);
+        if (err) {
+            std::cerr << err.value() << std::endl;
+            return 1;
+        }
+    }
+
+    err = check_bytecode_table<BlueprintFieldType>(circuits, assignments, opts.check, prof, "");
+    if (err) {
+        std::cerr << err.value() << std::endl;
         return 1;
     }
-    auto& bytecode_table = it->second;
-    if (!::is_satisfied<BlueprintFieldType>(circuits.m_bytecode_circuit, bytecode_table)) {
-        std::cerr << "Bytecode table is not satisfied!" << std::endl;
-        return 0;  // Do not produce failure for now
+
+    if (!opts.profile_file_name.empty()) {
+        err = prof.dump(opts.profile_file_name, opts.profile_format);
+        if (err) {
+            std::cerr << "Write profile failed: " << err.value() << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template<typename BlueprintFieldType>
+int curve_dependent_daemon(uint64_t shardId, const std::vector<std::string>& target_circuits,
+                           bool lazy_storage, const daemon_options& options,
+                           boost::log::trivial::severity_level log_level) {
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >= log_level);
+
+    assigner_daemon<BlueprintFieldType> daemon(options, shardId, target_circuits, lazy_storage,
+                                               log_level);
+    auto err = daemon.run();
+    if (err) {
+        std::cerr << "Assigner daemon failed: " << err.value() << std::endl;
+        return 1;
     }
     return 0;
 }
@@ -109,13 +309,58 @@ int main(int argc, char* argv[]) {
                                                                                    "Format is --columns <name>N|N-|-N|N-M(,N|N-|-N|N-M)*, where <name> is public_input|witness|constant|selector."
                                                                                    "If not specified, outputs all columns. "
                                                                                    "May be provided multiple times with different column types")
+            ("output-text-gzip", "Compress readable output with gzip")
             ("shard-id", boost::program_options::value<uint64_t>(), "ID of the shard where executed block")
-            ("block-hash", boost::program_options::value<std::string>(), "Hash of the input block")
-            ("block-file,b", boost::program_options::value<std::string>(), "Predefined input block with messages")
+            ("block-hash", boost::program_options::value<std::vector<std::string>>()->composing(), "Hash of the input block. "
+                                                                                              "May be provided multiple times to process a sequence of blocks")
+            ("block-file,b", boost::program_options::value<std::vector<std::string>>()->composing(), "Predefined input block with messages. "
+                                                                                                  "May be provided multiple times to process a sequence of blocks")
+            ("memory-budget", boost::program_options::value<std::size_t>(), "Megabytes of assignment tables buffered between execution and writing "
+                                                                            "when processing a sequence of blocks. Default: 1024")
+            ("spill-dir", boost::program_options::value<std::string>(), "Directory of temporary files for assignment tables of blocks exceeding half of the memory budget. "
+                                                                        "Finished tables are moved into memory mapped files after execution while waiting for writing, "
+                                                                        "tables of the executed block are still filled in memory")
             ("account-storage,s", boost::program_options::value<std::string>(), "Account storage config file")
+            ("lazy-storage", "Load storage of accounts requested via RPC by slots on the first access")
             ("elliptic-curve-type,e", boost::program_options::value<std::string>(), "Native elliptic curve type (pallas, vesta, ed25519, bls12381)")
             ("target-circuits", boost::program_options::value<std::vector<std::string>>(), "Fill assignment table only for certain circuits. If not set - fill assignments for all")
-            ("log-level,l", boost::program_options::value<std::string>(), "Log level (trace, debug, info, warning, error, fatal)");
+            ("log-level,l", boost::program_options::value<std::string>(), "Log level (trace, debug, info, warning, error, fatal)")
+            ("profile", boost::program_options::value<std::string>(), "Write timings of execution phases and messages to the file")
+            ("profile-format", boost::program_options::value<std::string>(), "Profile file format (json, chrome). Default: json")
+            ("rpc-host", boost::program_options::value<std::string>(), "Host of the node queried for blocks and accounts. Default: 127.0.0.1")
+            ("rpc-port", boost::program_options::value<int>(), "Port of the node queried for blocks and accounts. Default: 8529")
+            ("daemon", "Serve assignment jobs over local HTTP or Unix domain socket instead of running one block")
+            ("daemon-socket", boost::program_options::value<std::string>(), "Unix domain socket path of the daemon")
+            ("daemon-port", boost::program_options::value<int>(), "Local HTTP port of the daemon, used if socket is not set. Default: 8530")
+            ("max-jobs", boost::program_options::value<std::size_t>(), "Max number of jobs executed concurrently by the daemon. Default: 1")
+            ("daemon-work-dir", boost::program_options::value<std::string>(), "Directory which file paths of daemon jobs are relative to, "
+                                                                              "jobs can't access files outside of it. Default: current directory")
+            ("daemon-shutdown-token", boost::program_options::value<std::string>(), "Token authorizing shutdown requests to the daemon. "
+                                                                                    "If not set, the daemon is stopped by a signal only")
+            ("max-rows", boost::program_options::value<std::size_t>(), "Fail the block if some assignment table needs more rows. "
+                                                                       "Checked against the row estimate before execution and against filled tables after it")
+            ("segment-rows", boost::program_options::value<std::size_t>(), "Split binary assignment tables into segments of at most this number of rows. "
+                                                                           "Segments of 2^k - 1 rows are padded to 2^k")
+            ("segment-overlap", boost::program_options::value<std::size_t>(), "Rows of the previous segment repeated at the beginning of the next one. Default: 0")
+            ("table-format", boost::program_options::value<std::string>(), "Binary assignment table format (plain, compact). "
+                                                                           "Compact tables bit-pack selectors and run-length encode columns. Default: plain")
+            ("compress", boost::program_options::value<std::string>(), "Compress assignment tables and readable output in seekable chunks: codec[:level], "
+                                                                       "codec is none, gzip or zstd. Codec suffix is appended to file names. "
+                                                                       "Excludes --output-text-gzip")
+            ("write-digest", "Write digest manifest <assignment-tables>.N.digest.json with Keccak-256 hashes of every column and chunk of rows")
+            ("write-block-roots", boost::program_options::value<std::string>(), "Write SSZ hash tree roots of every block and of its input messages to the file, "
+                                                                                "to compare inputs of runs with --verify-block-roots")
+            ("verify-block-roots", boost::program_options::value<std::string>(), "Before execution compare SSZ hash tree roots of every block and of its input messages with the file written by --write-block-roots")
+            ("check-messages-root", "Check input messages of blocks fetched via RPC against the messages root of the block header before execution")
+            ("verify-against", boost::program_options::value<std::string>(), "Compare assignment tables with digest manifests <arg>.N.digest.json written by --write-digest "
+                                                                             "and report differing columns and rows. Fails if tables differ. "
+                                                                             "Tables of block I of a sequence are compared with <arg>.blockI.N.digest.json")
+            ("shared-static-columns", "Write constant and selector columns once into a file named by their hash and shared by all blocks, "
+                                      "per block table files reference it")
+            ("check-threads", boost::program_options::value<std::size_t>(), "Number of threads checking satisfiability of the tables. Default: all cores")
+            ("check-sample-confidence", boost::program_options::value<double>(), "Check satisfiability on randomly sampled rows only, "
+                                                                                 "detecting broken tables with the given probability (0-1)")
+            ("check-fault-rate", boost::program_options::value<double>(), "Min share of broken rows detected by the sampled check. Default: 0.01");
     // clang-format on
 
     boost::program_options::variables_map vm;
@@ -146,30 +391,79 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
-    uint64_t shardId = 0;
-    std::string assignment_table_file_name;
-    std::string blockHash;
-    std::string block_file_name;
-    std::string account_storage_file_name;
+    assigner_options opts;
     std::string elliptic_curve;
     std::string log_level;
-    std::vector<std::string> target_circuits;
+
+    if (vm.count("rpc-host")) {
+        opts.rpc.host = vm["rpc-host"].as<std::string>();
+    }
+    if (vm.count("rpc-port")) {
+        opts.rpc.port = vm["rpc-port"].as<int>();
+    }
+
+    const bool daemon_mode = vm.count("daemon") > 0;
+    daemon_options daemon_opts;
+    daemon_opts.rpc = opts.rpc;
+    if (vm.count("daemon-socket")) {
+        daemon_opts.unix_socket = vm["daemon-socket"].as<std::string>();
+    }
+    if (vm.count("daemon-port")) {
+        daemon_opts.port = vm["daemon-port"].as<int>();
+    }
+    if (vm.count("max-jobs")) {
+        daemon_opts.max_jobs = vm["max-jobs"].as<std::size_t>();
+        if (daemon_opts.max_jobs == 0) {
+            std::cerr << "Invalid command line argument --max-jobs: must be positive"
+                      << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+    }
+
+    if (vm.count("daemon-work-dir")) {
+        daemon_opts.work_directory = vm["daemon-work-dir"].as<std::string>();
+    }
+    if (vm.count("daemon-shutdown-token")) {
+        daemon_opts.shutdown_token = vm["daemon-shutdown-token"].as<std::string>();
+    }
+
+    // Blocks and output files of the daemon are given by each job, options of a single run
+    // without job counterpart are rejected instead of being silently ignored
+    if (daemon_mode) {
+        for (const char* option :
+             {"assignment-tables", "block-hash", "block-file", "account-storage", "output-text",
+              "output-text-gzip", "profile", "memory-budget", "spill-dir", "write-block-roots",
+              "verify-block-roots", "verify-against"}) {
+            if (vm.count(option)) {
+                std::cerr << "Invalid command line argument - --" << option
+                          << " is not supported with --daemon" << std::endl;
+                std::cout << options_desc << std::endl;
+                return 1;
+            }
+        }
+    }
 
     if (vm.count("assignment-tables")) {
-        assignment_table_file_name = vm["assignment-tables"].as<std::string>();
-    } else {
+        opts.assignment_table_file_name = vm["assignment-tables"].as<std::string>();
+    } else if (!daemon_mode) {
         std::cerr << "Invalid command line argument - assignment table file name is not specified"
                   << std::endl;
         std::cout << options_desc << std::endl;
         return 1;
     }
 
-    if (vm.count("block-file")) {
-        block_file_name = vm["block-file"].as<std::string>();
+    if (daemon_mode) {
+        if (vm.count("shard-id")) {
+            opts.shard_id = vm["shard-id"].as<uint64_t>();
+        }
+    } else if (vm.count("block-file")) {
+        for (const auto& block_file_name : vm["block-file"].as<std::vector<std::string>>()) {
+            opts.blocks.push_back({.file_name = block_file_name});
+        }
     } else {
-        block_file_name = "";
         if (vm.count("shard-id")) {
-            shardId = vm["shard-id"].as<uint64_t>();
+            opts.shard_id = vm["shard-id"].as<uint64_t>();
         } else {
             std::cerr << "Invalid command line argument - shard-id or block-file must be specified"
                       << std::endl;
@@ -178,7 +472,9 @@ int main(int argc, char* argv[]) {
         }
 
         if (vm.count("block-hash")) {
-            blockHash = vm["block-hash"].as<std::string>();
+            for (const auto& block_hash : vm["block-hash"].as<std::vector<std::string>>()) {
+                opts.blocks.push_back({.hash = block_hash});
+            }
         } else {
             std::cerr
                 << "Invalid command line argument - block-hash or block-file must be specified"
@@ -189,12 +485,122 @@ int main(int argc, char* argv[]) {
     }
 
     if (vm.count("account-storage")) {
-        account_storage_file_name = vm["account-storage"].as<std::string>();
-    } else {
-        account_storage_file_name = "";
+        opts.account_storage_file_name = vm["account-storage"].as<std::string>();
+    }
+
+    opts.lazy_storage = vm.count("lazy-storage") > 0;
+
+    if (vm.count("profile")) {
+        opts.profile_file_name = vm["profile"].as<std::string>();
+    }
+    if (vm.count("profile-format")) {
+        const auto format = profiler::parse_format(vm["profile-format"].as<std::string>());
+        if (!format) {
+            std::cerr << "Invalid command line argument --profile-format: "
+                      << vm["profile-format"].as<std::string>() << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+        opts.profile_format = format.value();
+    }
+
+    if (vm.count("max-rows")) {
+        opts.max_rows = vm["max-rows"].as<std::size_t>();
+    }
+
+    auto& table_opts = opts.table;
+    if (vm.count("segment-rows")) {
+        table_opts.segment_rows = vm["segment-rows"].as<std::size_t>();
+        if (table_opts.segment_rows == 0) {
+            std::cerr << "Invalid command line argument - segment rows must be positive"
+                      << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+    }
+    if (vm.count("segment-overlap")) {
+        table_opts.segment_overlap = vm["segment-overlap"].as<std::size_t>();
+        if (table_opts.segment_rows && table_opts.segment_overlap >= *table_opts.segment_rows) {
+            std::cerr << "Invalid command line argument - segment overlap must be less than "
+                         "segment rows"
+                      << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+    }
+
+    table_opts.shared_static_columns = vm.count("shared-static-columns") > 0;
+    table_opts.write_digest = vm.count("write-digest") > 0;
+    if (vm.count("verify-against")) {
+        opts.verify_digest_base = vm["verify-against"].as<std::string>();
+    }
+    if (vm.count("write-block-roots")) {
+        opts.write_block_roots_file = vm["write-block-roots"].as<std::string>();
+    }
+    if (vm.count("verify-block-roots")) {
+        opts.verify_block_roots_file = vm["verify-block-roots"].as<std::string>();
+    }
+    opts.check_messages_root = vm.count("check-messages-root") > 0;
+    if (vm.count("compress")) {
+        if (vm.count("output-text-gzip")) {
+            std::cerr << "Invalid command line argument - --compress and --output-text-gzip are "
+                         "mutually exclusive"
+                      << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+        auto compression = compression_options::parse(vm["compress"].as<std::string>());
+        if (!compression.has_value()) {
+            std::cerr << "Invalid command line argument - " << compression.error() << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+        table_opts.compression = compression.value();
+    }
+    if (vm.count("table-format")) {
+        const auto format = vm["table-format"].as<std::string>();
+        if (format == "compact") {
+            table_opts.format = table_format::compact;
+        } else if (format != "plain") {
+            std::cerr << "Invalid command line argument - table format: " << format << std::endl;
+            std::cout << options_desc << std::endl;
+            return 1;
+        }
+    }
+
+    auto& check_opts = opts.check;
+    if (vm.count("check-threads")) {
+        check_opts.threads = vm["check-threads"].as<std::size_t>();
+    }
+    if (vm.count("check-sample-confidence")) {
+        check_opts.sampled = true;
+        check_opts.confidence = vm["check-sample-confidence"].as<double>();
+    }
+    if (vm.count("check-fault-rate")) {
+        check_opts.fault_rate = vm["check-fault-rate"].as<double>();
+    }
+    if (check_opts.confidence <= 0 || check_opts.confidence >= 1 || check_opts.fault_rate <= 0 ||
+        check_opts.fault_rate >= 1) {
+        std::cerr << "Invalid command line argument - check confidence and fault rate must be "
+                     "in (0, 1)"
+                  << std::endl;
+        std::cout << options_desc << std::endl;
+        return 1;
+    }
+
+    auto& pipeline_opts = opts.pipeline;
+    if (vm.count("memory-budget")) {
+        pipeline_opts.memory_budget = vm["memory-budget"].as<std::size_t>() << 20;
+    }
+    if (vm.count("spill-dir")) {
+        pipeline_opts.spill_directory = vm["spill-dir"].as<std::string>();
+        if (!std::filesystem::is_directory(*pipeline_opts.spill_directory)) {
+            std::cerr << "Invalid command line argument - spill directory "
+                      << *pipeline_opts.spill_directory << " does not exist" << std::endl;
+            return 1;
+        }
     }
 
-    std::optional<OutputArtifacts> artifacts = std::nullopt;
     if (vm.count("output-text")) {
         auto maybe_artifacts = OutputArtifacts::from_program_options(vm);
         if (!maybe_artifacts.has_value()) {
@@ -202,9 +608,16 @@ int main(int argc, char* argv[]) {
             std::cout << options_desc << std::endl;
             return 1;
         }
-        artifacts = maybe_artifacts.value();
+        opts.artifacts = maybe_artifacts.value();
     }
 
+    // Jobs of the daemon share output, profile, limit and check options of a single run
+    daemon_opts.table = opts.table;
+    daemon_opts.check = opts.check;
+    daemon_opts.profile_format = opts.profile_format;
+    daemon_opts.check_messages_root = opts.check_messages_root;
+    daemon_opts.max_rows = opts.max_rows;
+
     if (vm.count("elliptic-curve-type")) {
         elliptic_curve = vm["elliptic-curve-type"].as<std::string>();
     } else {
@@ -212,7 +625,7 @@ int main(int argc, char* argv[]) {
     }
 
     if (vm.count("target-circuits")) {
-        target_circuits = vm["target-circuits"].as<std::vector<std::string>>();
+        opts.target_circuits = vm["target-circuits"].as<std::vector<std::string>>();
     }
 
     if (vm.count("log-level")) {
@@ -232,6 +645,8 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    opts.log_level = log_options[log_level];
+
     std::map<std::string, int> curve_options{
         {"pallas", 0},
         {"vesta", 1},
@@ -248,10 +663,14 @@ int main(int argc, char* argv[]) {
 
     switch (curve_options[elliptic_curve]) {
         case 0: {
+            if (daemon_mode) {
+                return curve_dependent_daemon<
+                    typename nil::crypto3::algebra::curves::pallas::base_field_type>(
+                    opts.shard_id, opts.target_circuits, opts.lazy_storage, daemon_opts,
+                    opts.log_level);
+            }
             return curve_dependent_main<
-                typename nil::crypto3::algebra::curves::pallas::base_field_type>(
-                shardId, blockHash, block_file_name, account_storage_file_name,
-                assignment_table_file_name, artifacts, target_circuits, log_options[log_level]);
+                typename nil::crypto3::algebra::curves::pallas::base_field_type>(opts);
             break;
         }
         case 1: {
@@ -263,10 +682,14 @@ int main(int argc, char* argv[]) {
             break;
         }
         case 3: {
+            if (daemon_mode) {
+                return curve_dependent_daemon<
+                    typename nil::crypto3::algebra::fields::bls12_base_field<381>>(
+                    opts.shard_id, opts.target_circuits, opts.lazy_storage, daemon_opts,
+                    opts.log_level);
+            }
             return curve_dependent_main<
-                typename nil::crypto3::algebra::fields::bls12_base_field<381>>(
-                shardId, blockHash, block_file_name, account_storage_file_name,
-                assignment_table_file_name, artifacts, target_circuits, log_options[log_level]);
+                typename nil::crypto3::algebra::fields::bls12_base_field<381>>(opts);
             break;
         }
     };
@@ -0,0 +1,113 @@
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include "zkevm_framework/rpc/fixture_server.hpp"
+
+namespace {
+    fixture_server* running_server = nullptr;
+
+    std::optional<rpc_endpoint> parse_endpoint(const std::string& address) {
+        const auto colon = address.rfind(':');
+        if (colon == std::string::npos || colon == 0) {
+            return {};
+        }
+        try {
+            std::size_t parsed = 0;
+            const auto port = std::stoi(address.substr(colon + 1), &parsed);
+            if (parsed != address.size() - colon - 1) {
+                return {};
+            }
+            return rpc_endpoint{address.substr(0, colon), port};
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    boost::program_options::options_description options_desc("zkEVM1 RPC fixture server");
+
+    // clang-format off
+    options_desc.add_options()("help,h", "Display help message")
+            ("fixtures,f", boost::program_options::value<std::string>(), "Directory of recorded responses")
+            ("record-from", boost::program_options::value<std::string>(), "Node address host:port, responses missing in fixtures are requested from it and saved")
+            ("host", boost::program_options::value<std::string>(), "Host to listen on. Default: 127.0.0.1")
+            ("port", boost::program_options::value<int>(), "Port to listen on. Default: 8529")
+            ("latency-ms", boost::program_options::value<std::size_t>(), "Delay added to every response. Default: 0")
+            ("jitter-ms", boost::program_options::value<std::size_t>(), "Upper bound of random delay added on top of latency. Default: 0")
+            ("threads", boost::program_options::value<std::size_t>(), "Requests handled concurrently. Default: 4");
+    // clang-format on
+
+    boost::program_options::variables_map vm;
+    try {
+        boost::program_options::store(
+            boost::program_options::command_line_parser(argc, argv).options(options_desc).run(),
+            vm);
+        boost::program_options::notify(vm);
+    } catch (const boost::program_options::error& e) {
+        std::cerr << "Invalid command line argument: " << e.what() << std::endl;
+        std::cout << options_desc << std::endl;
+        return 1;
+    }
+
+    if (vm.count("help")) {
+        std::cout << options_desc << std::endl;
+        return 0;
+    }
+
+    if (!vm.count("fixtures")) {
+        std::cerr << "Invalid command line argument - fixtures directory is not specified"
+                  << std::endl;
+        std::cout << options_desc << std::endl;
+        return 1;
+    }
+
+    fixture_server_options options;
+    options.fixtures_dir = vm["fixtures"].as<std::string>();
+    if (vm.count("record-from")) {
+        options.record_from = parse_endpoint(vm["record-from"].as<std::string>());
+        if (!options.record_from) {
+            std::cerr << "Invalid command line argument - record-from must be host:port"
+                      << std::endl;
+            return 1;
+        }
+    }
+    if (vm.count("host")) {
+        options.listen.host = vm["host"].as<std::string>();
+    }
+    if (vm.count("port")) {
+        options.listen.port = vm["port"].as<int>();
+    }
+    if (vm.count("latency-ms")) {
+        options.latency = std::chrono::milliseconds(vm["latency-ms"].as<std::size_t>());
+    }
+    if (vm.count("jitter-ms")) {
+        options.latency_jitter = std::chrono::milliseconds(vm["jitter-ms"].as<std::size_t>());
+    }
+    if (vm.count("threads")) {
+        options.threads = vm["threads"].as<std::size_t>();
+        if (options.threads == 0) {
+            std::cerr << "Invalid command line argument - threads must be positive" << std::endl;
+            return 1;
+        }
+    }
+
+    fixture_server server(std::move(options));
+    running_server = &server;
+    std::signal(SIGINT, [](int) { running_server->stop(); });
+    std::signal(SIGTERM, [](int) { running_server->stop(); });
+
+    auto err = server.run();
+    if (err) {
+        std::cerr << "Fixture server failed: " << err.value() << std::endl;
+        return 1;
+    }
+    std::cout << "Served " << server.hits() << " fixtures, recorded " << server.recorded()
+              << ", missing " << server.misses() << std::endl;
+    return 0;
+}
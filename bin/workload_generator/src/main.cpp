@@ -0,0 +1,96 @@
+#include <boost/program_options.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "zkevm_framework/assigner_runner/workload_generator.hpp"
+
+int main(int argc, char* argv[]) {
+    boost::program_options::options_description options_desc("zkEVM1 workload generator");
+
+    // clang-format off
+    options_desc.add_options()("help,h", "Display help message")
+            ("output,o", boost::program_options::value<std::string>(), "Output directory for block<i>.json files and state.json")
+            ("blocks", boost::program_options::value<std::size_t>(), "Number of blocks. Default: 1")
+            ("messages", boost::program_options::value<std::size_t>(), "Messages in each block. Default: 16")
+            ("contract-mix", boost::program_options::value<std::string>(), "Share of messages calling each contract kind. "
+                                                                           "Format is kind:weight(,kind:weight)*, kinds are counter, storage, hasher, arithmetic. "
+                                                                           "Default: all kinds equally")
+            ("contracts-per-kind", boost::program_options::value<std::size_t>(), "Deployed contracts of each kind. Default: 4")
+            ("calldata-bytes", boost::program_options::value<std::size_t>(), "Calldata size of each message. Default: 64")
+            ("storage-slots", boost::program_options::value<std::size_t>(), "Initialized storage slots of each contract. Default: 16")
+            ("loop-iterations", boost::program_options::value<std::size_t>(), "Iterations of arithmetic contract loop. Default: 64")
+            ("seed", boost::program_options::value<std::uint64_t>(), "Seed of random generator. Default: 1");
+    // clang-format on
+
+    boost::program_options::variables_map vm;
+    try {
+        boost::program_options::store(
+            boost::program_options::command_line_parser(argc, argv).options(options_desc).run(),
+            vm);
+        boost::program_options::notify(vm);
+    } catch (const boost::program_options::error& e) {
+        std::cerr << "Invalid command line argument: " << e.what() << std::endl;
+        std::cout << options_desc << std::endl;
+        return 1;
+    }
+
+    if (vm.count("help")) {
+        std::cout << options_desc << std::endl;
+        return 0;
+    }
+
+    if (!vm.count("output")) {
+        std::cerr << "Invalid command line argument - output directory is not specified"
+                  << std::endl;
+        std::cout << options_desc << std::endl;
+        return 1;
+    }
+
+    workload_options options;
+    if (vm.count("blocks")) {
+        options.blocks = vm["blocks"].as<std::size_t>();
+    }
+    if (vm.count("messages")) {
+        options.messages_per_block = vm["messages"].as<std::size_t>();
+    }
+    if (vm.count("contract-mix")) {
+        auto mix = workload_options::parse_contract_mix(vm["contract-mix"].as<std::string>());
+        if (!mix) {
+            std::cerr << "Invalid command line argument - " << mix.error() << std::endl;
+            return 1;
+        }
+        options.contract_mix = mix.value();
+    }
+    if (vm.count("contracts-per-kind")) {
+        options.contracts_per_kind = vm["contracts-per-kind"].as<std::size_t>();
+    }
+    if (vm.count("calldata-bytes")) {
+        options.calldata_bytes = vm["calldata-bytes"].as<std::size_t>();
+    }
+    if (vm.count("storage-slots")) {
+        options.storage_slots = vm["storage-slots"].as<std::size_t>();
+    }
+    if (vm.count("loop-iterations")) {
+        options.loop_iterations = vm["loop-iterations"].as<std::size_t>();
+    }
+    if (vm.count("seed")) {
+        options.seed = vm["seed"].as<std::uint64_t>();
+    }
+
+    auto generated = generate_workload(options);
+    if (!generated) {
+        std::cerr << "Workload generation failed: " << generated.error() << std::endl;
+        return 1;
+    }
+    const auto output = vm["output"].as<std::string>();
+    auto err = write_workload(generated.value(), output);
+    if (err) {
+        std::cerr << "Write workload failed: " << err.value() << std::endl;
+        return 1;
+    }
+    std::cout << "Generated " << generated->blocks.size() << " blocks with "
+              << generated->messages << " messages in " << output << std::endl;
+    return 0;
+}
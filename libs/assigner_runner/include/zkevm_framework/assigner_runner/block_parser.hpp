@@ -5,6 +5,7 @@
 #include <optional>
 #include <string>
 
+#include "zkevm_framework/assigner_runner/input_messages.hpp"
 #include "zkevm_framework/core/types/block.hpp"
 #include "zkevm_framework/core/types/message.hpp"
 
@@ -14,9 +15,9 @@ std::optional<std::string> load_block_with_messages(core::types::Block& block,
                                                     std::istream& block_data);
 
 /// @brief Fill block and input messages from input stream which contains serialized block and
-/// messages
+/// messages. Messages are kept serialized and read through views.
 std::optional<std::string> load_raw_block_with_messages(core::types::Block& block,
-                                                        std::vector<core::types::Message>& messages,
+                                                        input_messages& messages,
                                                         std::istream& block_data);
 
 #endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BLOCK_PARSER_HPP_
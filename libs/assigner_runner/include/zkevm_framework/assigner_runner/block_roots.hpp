@@ -0,0 +1,59 @@
+/**
+ * @file block_roots.hpp
+ *
+ * @brief Roots of ingested blocks: SSZ hash tree roots for detecting changes of input data and
+ * the trie root of input messages for checking them against the block header.
+ *
+ * SSZ roots are a fingerprint of the input of a run, not a validation of it: the header stores
+ * trie roots only, so they are compared with roots recorded by another run, e.g. to make sure
+ * replayed fixtures are the data a reference run was made on. Validation of input messages
+ * against the header is done by `in_messages_trie_root`.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BLOCK_ROOTS_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BLOCK_ROOTS_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/input_messages.hpp"
+#include "zkevm_framework/core/common.hpp"
+#include "zkevm_framework/core/types/block.hpp"
+
+/// @brief SSZ hash tree roots of a block header and of the list of its input messages, used to
+/// compare inputs of two runs
+struct block_roots {
+    core::Hash block;
+    core::Hash in_messages;
+
+    bool operator==(const block_roots& other) const = default;
+};
+
+/**
+ * @brief Compute roots of the block, messages are hashed by `threads` threads, 0 means
+ * hardware concurrency.
+ */
+block_roots compute_block_roots(const core::types::Block& block, const input_messages& messages,
+                                std::size_t threads = 0);
+
+/**
+ * @brief Root of the Merkle Patricia trie of input messages as stored in `m_in_messages_root`:
+ * keys are SSZ encoded message indices, values are SSZ encoded messages. The trie is built in
+ * bulk and its nodes are hashed by `threads` threads, 0 means hardware concurrency. Root of no
+ * messages is zero.
+ *
+ * The layout mirrors the node, but it is compared with roots of real node blocks only by
+ * runner_test on recorded blocks, so the check using it is opt-in.
+ */
+core::Hash in_messages_trie_root(const input_messages& messages, std::size_t threads = 0);
+
+/// @brief Serialize roots of a block sequence into JSON manifest
+std::string block_roots_to_json(const std::vector<block_roots>& roots);
+
+/// @brief Parse JSON manifest of a block sequence
+std::optional<std::string> block_roots_from_json(const std::string& json,
+                                                 std::vector<block_roots>& result);
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BLOCK_ROOTS_HPP_
@@ -0,0 +1,93 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BOUNDED_QUEUE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BOUNDED_QUEUE_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/// @brief Blocking queue connecting pipeline stages.
+///
+/// Queue is bounded both by number of items and by their total size in bytes, so a fast
+/// producer is blocked until the consumer catches up. An item larger than the byte limit is
+/// accepted when the queue is empty, otherwise it could never be pushed.
+template<typename T>
+class bounded_queue {
+  public:
+    bounded_queue(std::size_t max_items, std::size_t max_bytes)
+        : m_max_items(max_items), m_max_bytes(max_bytes) {}
+
+    /// @brief Push item of given size, waiting for free space.
+    /// @returns false if the queue was closed, the item is dropped then
+    bool push(T item, std::size_t bytes = 0) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_full.wait(lock, [&] {
+            return m_closed || m_items.empty() ||
+                   (m_items.size() < m_max_items && m_bytes + bytes <= m_max_bytes);
+        });
+        if (m_closed) {
+            return false;
+        }
+        m_items.emplace_back(std::move(item), bytes);
+        m_bytes += bytes;
+        m_not_empty.notify_one();
+        return true;
+    }
+
+    /// @brief Pop the oldest item, waiting for it.
+    /// @returns std::nullopt if the queue is closed and there is nothing left
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_empty.wait(lock, [&] { return !m_items.empty() || m_finished || m_closed; });
+        if (m_closed || m_items.empty()) {
+            return std::nullopt;
+        }
+        auto [item, bytes] = std::move(m_items.front());
+        m_items.pop_front();
+        m_bytes -= bytes;
+        m_not_full.notify_all();
+        return std::move(item);
+    }
+
+    /// @brief No more items will be pushed, consumer drains the remaining ones
+    void finish() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished = true;
+        m_not_empty.notify_all();
+    }
+
+    /// @brief Abort processing: remaining items are dropped and all waiters are released
+    void close() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_items.clear();
+        m_bytes = 0;
+        m_not_empty.notify_all();
+        m_not_full.notify_all();
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_items.size();
+    }
+
+    std::size_t bytes() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes;
+    }
+
+  private:
+    const std::size_t m_max_items;
+    const std::size_t m_max_bytes;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+    std::deque<std::pair<T, std::size_t>> m_items;
+    std::size_t m_bytes = 0;
+    bool m_finished = false;
+    bool m_closed = false;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_BOUNDED_QUEUE_HPP_
@@ -0,0 +1,53 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_CODE_CACHE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_CODE_CACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "zkevm_framework/core/mpt/flat_node_map.hpp"
+#include "zkevm_framework/core/mpt/hasher.hpp"
+#include "zkevm_framework/core/mpt/node_key.hpp"
+
+/// @brief Immutable contract code with its hash
+class cached_code {
+  public:
+    cached_code(std::span<const uint8_t> code, const core::mpt::NodeKey& code_hash)
+        : m_code(code.begin(), code.end()), m_hash(code_hash) {}
+
+    const uint8_t* data() const { return m_code.data(); }
+    std::size_t size() const { return m_code.size(); }
+    std::span<const uint8_t> code() const { return m_code; }
+    const core::mpt::NodeKey& hash() const { return m_hash; }
+
+  private:
+    const std::vector<uint8_t> m_code;
+    const core::mpt::NodeKey m_hash;
+};
+
+/// @brief Content-addressed cache of contract code. Code is keyed by its Keccak-256 hash, so
+/// contracts sharing code share one buffer.
+class code_cache {
+  public:
+    using code_ptr = std::shared_ptr<const cached_code>;
+
+    /// @brief Get shared code, storing it on the first request
+    code_ptr get(std::span<const uint8_t> code);
+
+    /// @brief Find code by its hash, nullptr if it was never requested
+    code_ptr find(const core::mpt::NodeKey& code_hash) const;
+
+    std::size_t size() const { return m_entries.size(); }
+    std::size_t hits() const { return m_hits; }
+    std::size_t misses() const { return m_misses; }
+
+  private:
+    core::mpt::Keccak256Hasher m_hasher;
+    core::mpt::FlatNodeMap<core::mpt::NodeKey, code_ptr, core::mpt::NodeKeyHash> m_entries;
+    std::size_t m_hits = 0;
+    std::size_t m_misses = 0;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_CODE_CACHE_HPP_
@@ -0,0 +1,186 @@
+/**
+ * @file compression.hpp
+ *
+ * @brief Seekable chunked compression of output files.
+ *
+ * Data is split into chunks of fixed size, every chunk is compressed into an independent zstd
+ * frame or gzip member. Frames are followed by an index of their sizes wrapped into zstd
+ * skippable frame:
+ *
+ *     frame_0 ... frame_n-1
+ *     u32 0x184D2A5E, u32 index size
+ *     (u64 compressed size, u64 uncompressed size) * n
+ *     u64 n, u32 codec, "zkcz"
+ *
+ * All integers are little endian. zstd tools decompress such files as is, gzip tools
+ * decompress them with a warning about trailing garbage.
+ *
+ * Chunks are cut by size rather than at column boundaries: compact columns take from a few
+ * bytes to megabytes, so a frame per column would either be too small to compress well or too
+ * large to split the work between threads. Offsets of columns are known from the table header,
+ * a column is read by `chunked_decompressor::read` decompressing only frames overlapping it.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_COMPRESSION_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_COMPRESSION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <expected>
+#include <future>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/bounded_queue.hpp"
+
+enum class compression_codec : std::uint32_t {
+    none = 0,
+    gzip = 1,
+    zstd = 2,
+};
+
+struct compression_options {
+    compression_codec codec = compression_codec::none;
+    /// @brief Compression level, 0 means default level of the codec
+    int level = 0;
+    /// @brief Uncompressed bytes in one frame
+    std::size_t chunk_size = 4 << 20;
+    /// @brief Number of compressing threads, 0 means hardware concurrency
+    std::size_t threads = 0;
+
+    /// @brief Parse `codec[:level]` where codec is none, gzip or zstd
+    static std::expected<compression_options, std::string> parse(const std::string& spec);
+};
+
+/// @brief Suffix appended to names of files compressed with the codec
+std::string compression_suffix(compression_codec codec);
+
+/// @brief Compress data into a single frame
+std::string compress_frame(std::string_view data, compression_codec codec, int level);
+
+/// @brief Decompress a single frame
+std::optional<std::string> decompress_frame(std::string_view frame, compression_codec codec,
+                                            std::string& out);
+
+/// @brief Compress data into chunked format in memory
+std::string compress_chunked(std::string_view data, const compression_options& options);
+
+/**
+ * @brief Stream buffer writing data in chunked format. Full chunks are compressed concurrently
+ * by a pool of `compression_options::threads` workers started on demand, a bounded window of
+ * chunks is kept in memory.
+ */
+class chunked_compress_buf : public std::streambuf {
+  public:
+    chunked_compress_buf(std::ostream& out, const compression_options& options);
+    ~chunked_compress_buf() override;
+
+    /// @brief Compress the rest of data and write index. Nothing can be written afterwards.
+    void close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+  private:
+    struct compress_job {
+        std::string chunk;
+        std::promise<std::string> frame;
+    };
+
+    void submit_chunk();
+    void write_frames(std::size_t max_pending);
+    void compress_chunks();
+
+    std::ostream& m_out;
+    compression_options m_options;
+    std::size_t m_threads;
+    std::size_t m_window;
+    std::string m_chunk;
+    std::deque<std::pair<std::size_t, std::future<std::string>>> m_pending;
+    // Compressed and uncompressed sizes of written frames
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> m_index;
+    bool m_closed = false;
+    bounded_queue<compress_job> m_jobs;
+    // Declared last to be joined before the rest is destroyed
+    std::vector<std::jthread> m_workers;
+};
+
+/**
+ * @brief Output stream writing data in chunked format, see `chunked_compress_buf`.
+ */
+class chunked_compress_ostream : public std::ostream {
+  public:
+    chunked_compress_ostream(std::ostream& out, const compression_options& options)
+        : std::ostream(nullptr), m_buf(out, options) {
+        rdbuf(&m_buf);
+    }
+
+    void close() { m_buf.close(); }
+
+  private:
+    chunked_compress_buf m_buf;
+};
+
+/**
+ * @brief Reader of chunked format with random access to uncompressed data.
+ */
+class chunked_decompressor {
+  public:
+    /// @brief Read index of frames from seekable stream, it must outlive the reader
+    std::optional<std::string> open(std::istream& in);
+
+    compression_codec codec() const { return m_codec; }
+    std::size_t chunks_amount() const { return m_chunks.size(); }
+    /// @brief Size of uncompressed data
+    std::size_t size() const { return m_size; }
+
+    /// @brief Decompress chunk by its index
+    std::optional<std::string> read_chunk(std::size_t index, std::string& out) const;
+
+    /// @brief Decompress `length` bytes starting from `offset` of uncompressed data
+    std::optional<std::string> read(std::size_t offset, std::size_t length,
+                                    std::string& out) const;
+
+  private:
+    struct chunk {
+        std::uint64_t offset;
+        std::uint64_t compressed_size;
+        std::uint64_t uncompressed_offset;
+        std::uint64_t uncompressed_size;
+    };
+
+    std::istream* m_in = nullptr;
+    compression_codec m_codec = compression_codec::none;
+    std::vector<chunk> m_chunks;
+    std::size_t m_size = 0;
+};
+
+/**
+ * @brief Stream buffer reading chunked format sequentially, one chunk is decompressed at a
+ * time. Errors of decompression are reported by `error()`, the stream ends at a broken chunk.
+ */
+class chunked_decompress_buf : public std::streambuf {
+  public:
+    explicit chunked_decompress_buf(const chunked_decompressor& reader) : m_reader(reader) {}
+
+    const std::optional<std::string>& error() const { return m_error; }
+
+  protected:
+    int_type underflow() override;
+
+  private:
+    const chunked_decompressor& m_reader;
+    std::size_t m_next_chunk = 0;
+    std::string m_chunk;
+    std::optional<std::string> m_error;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_COMPRESSION_HPP_
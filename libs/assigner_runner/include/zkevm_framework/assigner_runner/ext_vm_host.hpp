@@ -3,6 +3,15 @@
 
 #include <vm_host.hpp>
 
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "zkevm_framework/assigner_runner/code_cache.hpp"
+#include "zkevm_framework/assigner_runner/lazy_storage.hpp"
 #include "zkevm_framework/assigner_runner/state_parser.hpp"
 #include "zkevm_framework/assigner_runner/utils.hpp"
 #include "zkevm_framework/rpc/data_extractor.hpp"
@@ -29,6 +38,85 @@ class ExtVMHost : public VMHost<BlueprintFieldType> {
           m_extractor(extractor),
           m_prevBlockHash(prevBlockHash) {}
 
+    ~ExtVMHost() {
+        // Loader refers to this host
+        if (m_lazy_storage != nullptr) {
+            m_lazy_storage->set_slot_loader({});
+        }
+    }
+
+    /// @brief Load storage of accounts fetched via RPC by slots on the first access instead of
+    /// parsing whole storage maps. Accounts which are already known keep their storage.
+    ///
+    /// Storage is owned by the caller, so it outlives the host together with the accounts:
+    /// contracts opened by a previous host stay managed. Slots which are not loaded yet are
+    /// read at the state of `prevBlockHash` until the storage is passed to another host.
+    void enable_lazy_storage(lazy_storage& storage) {
+        storage.set_slot_loader([this](const evmc::address& addr, const evmc::bytes32& key,
+                                       evmc::bytes32& value) -> std::optional<std::string> {
+            BOOST_LOG_TRIVIAL(debug) << "Get storage slot (" << to_str(addr) << ", " << to_str(key)
+                                     << ") via RPC";
+            std::stringstream slot_data;
+            auto err = m_extractor.get_storage_at(to_str(addr), to_str(key), m_prevBlockHash,
+                                                  slot_data);
+            if (err) {
+                return err;
+            }
+            return load_storage_slot(value, slot_data);
+        });
+        m_lazy_storage = &storage;
+    }
+
+    /// @brief Code of the account shared through the cache without copying it per message.
+    /// Empty code is returned for unknown accounts.
+    code_cache::code_ptr get_cached_code(const evmc::address& addr, code_cache& cache) {
+        // Non-empty code of an account never changes, so it is resolved once per host
+        if (const auto it = m_account_code.find(addr); it != m_account_code.end()) {
+            return it->second;
+        }
+        const auto account_it = get_account(addr);
+        if (account_it == this->accounts.end()) {
+            return cache.get({});
+        }
+        const auto& code = account_it->second.code;
+        auto result = cache.get(std::span<const uint8_t>(code.data(), code.size()));
+        if (!code.empty()) {
+            m_account_code.emplace(addr, result);
+        }
+        return result;
+    }
+
+    /// @brief First storage error since the previous call. Host interface can't fail, so
+    /// failed slot loads read as zero and the caller must check for errors after execution.
+    std::optional<std::string> take_storage_error() { return std::exchange(m_storage_error, {}); }
+
+    evmc::bytes32 get_storage(const evmc::address& addr,
+                              const evmc::bytes32& key) const noexcept override {
+        if (!m_lazy_storage || !m_lazy_storage->has_contract(addr)) {
+            return VMHost<BlueprintFieldType>::get_storage(addr, key);
+        }
+        // Lazy storage keeps every slot read or written, so it is the source of managed slots.
+        // It is held by pointer: host interface reads are const.
+        evmc::bytes32 value{};
+        if (auto err = m_lazy_storage->get(addr, key, value)) {
+            record_storage_error("Failed loading storage: " + err.value());
+        }
+        return value;
+    }
+
+    evmc_storage_status set_storage(const evmc::address& addr, const evmc::bytes32& key,
+                                    const evmc::bytes32& value) noexcept override {
+        // Original value is required to compute storage status
+        load_storage_slot_value(addr, key);
+        if (m_lazy_storage && m_lazy_storage->has_contract(addr)) {
+            auto err = m_lazy_storage->set(addr, key, value);
+            if (err) {
+                record_storage_error("Failed updating storage: " + err.value());
+            }
+        }
+        return VMHost<BlueprintFieldType>::set_storage(addr, key, value);
+    }
+
   protected:
     evmc::accounts::iterator get_account(const evmc::address& addr) noexcept override {
         const auto find_it = this->accounts.find(addr);
@@ -44,7 +132,15 @@ class ExtVMHost : public VMHost<BlueprintFieldType> {
             return this->accounts.end();
         }
         evmc::account new_account;
-        err = load_account_with_storage(new_account, account_data);
+        if (m_lazy_storage) {
+            core::Hash storage_root;
+            err = load_account(new_account, storage_root, account_data);
+            if (!err) {
+                m_lazy_storage->open_contract(addr, storage_root);
+            }
+        } else {
+            err = load_account_with_storage(new_account, account_data);
+        }
         if (err) {
             BOOST_LOG_TRIVIAL(error) << "Failed parsing account data: " << err.value();
             return this->accounts.end();
@@ -58,8 +154,37 @@ class ExtVMHost : public VMHost<BlueprintFieldType> {
     }
 
   private:
+    void load_storage_slot_value(const evmc::address& addr, const evmc::bytes32& key) noexcept {
+        if (!m_lazy_storage || !m_lazy_storage->has_contract(addr)) {
+            return;
+        }
+        // Slot may be loaded by a read already, which doesn't touch the account storage
+        const auto account_it = this->accounts.find(addr);
+        if (account_it == this->accounts.end() || account_it->second.storage.contains(key)) {
+            return;
+        }
+        evmc::bytes32 value;
+        auto err = m_lazy_storage->get(addr, key, value);
+        if (err) {
+            record_storage_error("Failed loading storage: " + err.value());
+            return;
+        }
+        account_it->second.storage.emplace(key, value);
+    }
+
+    void record_storage_error(std::string error) const noexcept {
+        BOOST_LOG_TRIVIAL(error) << error;
+        if (!m_storage_error) {
+            m_storage_error = std::move(error);
+        }
+    }
+
     const data_extractor& m_extractor;
     const std::string m_prevBlockHash;
+    // Slots are loaded on reads through the const host interface, nullptr if not enabled
+    lazy_storage* m_lazy_storage = nullptr;
+    mutable std::optional<std::string> m_storage_error;
+    std::unordered_map<evmc::address, code_cache::code_ptr> m_account_code;
 };
 
 #endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_EXT_VM_HOST_HPP_
@@ -0,0 +1,96 @@
+/**
+ * @file input_messages.hpp
+ *
+ * @brief Input messages of a block, owned or kept serialized.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_INPUT_MESSAGES_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_INPUT_MESSAGES_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "zkevm_framework/core/types/message.hpp"
+#include "zkevm_framework/core/types/views.hpp"
+
+/**
+ * @brief Input messages of a block.
+ *
+ * Messages parsed from JSON are owned. Messages received serialized are kept in one buffer and
+ * read through `core::types::MessageView`, so loading them allocates only the buffer and the
+ * views. Both kinds have the same accessors and are consumed with `for_each`.
+ *
+ * Views point into the buffer, so the container can be moved but not copied.
+ */
+class input_messages {
+  public:
+    input_messages() = default;
+    input_messages(std::vector<core::types::Message> parsed) : m_parsed(std::move(parsed)) {}
+
+    input_messages(const input_messages&) = delete;
+    input_messages& operator=(const input_messages&) = delete;
+    input_messages(input_messages&&) = default;
+    input_messages& operator=(input_messages&&) = default;
+
+    /**
+     * @brief Take serialized messages, message `i` ends at `ends[i]` in `bytes` and begins where
+     * the previous one ends. Previous messages are dropped.
+     */
+    std::optional<std::string> assign_serialized(std::vector<std::byte> bytes,
+                                                 const std::vector<std::size_t>& ends) {
+        m_parsed.clear();
+        m_views.clear();
+        m_bytes = std::move(bytes);
+        m_views.reserve(ends.size());
+        const std::span<const std::byte> all(m_bytes);
+        std::size_t begin = 0;
+        for (const auto end : ends) {
+            if (end < begin || end > all.size()) {
+                return "Message " + std::to_string(m_views.size()) + " is out of buffer";
+            }
+            auto view = core::types::MessageView::parse(all.subspan(begin, end - begin));
+            if (!view) {
+                return "Message " + std::to_string(m_views.size()) + " is malformed";
+            }
+            m_views.push_back(view.value());
+            begin = end;
+        }
+        return {};
+    }
+
+    std::size_t size() const { return m_parsed.size() + m_views.size(); }
+    bool empty() const { return size() == 0; }
+
+    /// @brief Call `visit` for every message in order, with `const core::types::Message&` or
+    /// `const core::types::MessageView&`
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (const auto& message : m_parsed) {
+            visit(message);
+        }
+        for (const auto& view : m_views) {
+            visit(view);
+        }
+    }
+
+    /// @brief Call `visit` for message `index`
+    template<typename Visitor>
+    void visit_at(std::size_t index, Visitor&& visit) const {
+        if (index < m_parsed.size()) {
+            visit(m_parsed[index]);
+        } else {
+            visit(m_views[index - m_parsed.size()]);
+        }
+    }
+
+  private:
+    std::vector<core::types::Message> m_parsed;
+    std::vector<std::byte> m_bytes;
+    std::vector<core::types::MessageView> m_views;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_INPUT_MESSAGES_HPP_
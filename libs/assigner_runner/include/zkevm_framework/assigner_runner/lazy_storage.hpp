@@ -0,0 +1,67 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_LAZY_STORAGE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_LAZY_STORAGE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "vm_host.hpp"
+#include "zkevm_framework/core/common.hpp"
+#include "zkevm_framework/core/mpt/mpt.hpp"
+
+/// @brief Contract storage loaded slot by slot on the first access.
+///
+/// Storage of every contract is backed by its own storage trie which is updated on each write,
+/// so post-block storage roots are always up to date. If node loader is set, tries are opened at
+/// pre-block storage roots and slots are read from them: only nodes on touched paths are loaded
+/// and resulting roots are exact. Otherwise slots come from the slot loader and tries contain
+/// touched slots only, so their roots cover just these slots.
+class lazy_storage {
+  public:
+    using slot_loader = std::function<std::optional<std::string>(
+        const evmc::address& addr, const evmc::bytes32& key, evmc::bytes32& value)>;
+
+    explicit lazy_storage(slot_loader load_slot, core::mpt::NodeLoader load_node = {});
+
+    /// @brief Replace loader of slots which are not loaded yet, e.g. to read them at the state
+    /// of the next block. Loaded slots keep their values.
+    void set_slot_loader(slot_loader load_slot) { m_load_slot = std::move(load_slot); }
+
+    /// @brief Register contract with its pre-block storage root. Storage of unregistered
+    /// contracts is not managed.
+    void open_contract(const evmc::address& addr, const core::Hash& storage_root);
+
+    bool has_contract(const evmc::address& addr) const;
+    bool is_loaded(const evmc::address& addr, const evmc::bytes32& key) const;
+
+    /// @brief Get slot value, loading it on the first access
+    std::optional<std::string> get(const evmc::address& addr, const evmc::bytes32& key,
+                                   evmc::bytes32& value);
+
+    /// @brief Update slot value and contract storage trie
+    std::optional<std::string> set(const evmc::address& addr, const evmc::bytes32& key,
+                                   const evmc::bytes32& value);
+
+    /// @brief Current storage root of the contract, zero hash for empty storage
+    core::Hash storage_root(const evmc::address& addr) const;
+
+    std::vector<evmc::address> contracts() const;
+    std::size_t loaded_slots() const;
+
+  private:
+    struct contract_storage {
+        core::mpt::MerklePatriciaTrie trie;
+        // Slots read or written during execution
+        std::unordered_map<evmc::bytes32, evmc::bytes32> slots;
+    };
+
+    slot_loader m_load_slot;
+    core::mpt::NodeLoader m_load_node;
+    std::unordered_map<evmc::address, contract_storage> m_contracts;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_LAZY_STORAGE_HPP_
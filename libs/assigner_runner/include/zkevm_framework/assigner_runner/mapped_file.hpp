@@ -0,0 +1,48 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_MAPPED_FILE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+/// @brief Anonymous temporary file filled by appending and then mapped read-only, or an existing
+/// file mapped read-only.
+///
+/// The temporary file is unlinked right after creation, so it is removed by the system when the
+/// mapping is released, even if the process crashes. Pages of the mapping are backed by the file
+/// and can be evicted from RAM under memory pressure.
+class mapped_file {
+  public:
+    mapped_file() = default;
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file(mapped_file&& other) noexcept;
+    mapped_file& operator=(mapped_file&& other) noexcept;
+    ~mapped_file();
+
+    /// @brief Create temporary file in the directory
+    std::optional<std::string> create(const std::string& directory);
+
+    /// @brief Append data to the file, returns error if writing failed
+    std::optional<std::string> append(std::span<const std::uint8_t> data);
+
+    /// @brief Map written data, nothing can be appended afterwards
+    std::optional<std::string> map();
+
+    /// @brief Map existing file
+    std::optional<std::string> open(const std::string& filename);
+
+    const std::uint8_t* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+  private:
+    void reset();
+
+    int m_fd = -1;
+    std::size_t m_size = 0;
+    const std::uint8_t* m_data = nullptr;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_MAPPED_FILE_HPP_
@@ -0,0 +1,84 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_PIPELINE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_PIPELINE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "output_artifacts.hpp"
+#include "zkevm_framework/assigner_runner/runner.hpp"
+#include "zkevm_framework/assigner_runner/spilled_table.hpp"
+
+/// @brief Input block given either by hash (loaded via RPC) or by file
+struct block_source {
+    std::string hash;
+    std::string file_name;
+};
+
+struct pipeline_options {
+    /// @brief Bytes of assignment tables allowed to be buffered between stages
+    std::size_t memory_budget = std::size_t{1} << 30;
+    /// @brief Max number of blocks waiting in each stage queue
+    std::size_t queue_depth = 2;
+    /// @brief Directory of temporary files of spilled tables. If set, finished tables of a block
+    /// not fitting into the buffer share of the memory budget are moved into memory mapped files
+    /// after execution and wait for the write stage there, see `spilled_table`. This bounds
+    /// memory of blocks queued between stages only: tables of the block being executed are
+    /// filled in memory, so peak memory of a single huge block is not reduced. Not used when
+    /// text artifacts are requested.
+    std::optional<std::string> spill_directory;
+};
+
+/// @brief Process sequence of blocks overlapping stages of neighbouring blocks.
+///
+/// Stages are fetch (load and parse block), execute (fill assignment tables), serialize
+/// (binary tables and text artifacts) and write. Each stage runs on its own thread, the write
+/// stage runs on the calling one. Stages are connected by bounded queues, tables waiting for
+/// serialization and serialized tables waiting for write share the memory budget, so
+/// execution blocks when writing falls behind. Blocks are executed in the given order against
+/// the same account state. Tables of block `i` are written to `<base>.block<i>.<table>`.
+/// Output files, including tables streamed from spilled ones and shared static columns, are
+/// written by the write stage only, a failed write stops the pipeline.
+template<typename BlueprintFieldType>
+class block_pipeline {
+  public:
+    using assignments_type = typename single_thread_runner<BlueprintFieldType>::assignments_type;
+    using spilled_assignments_type = std::unordered_map<
+        nil::evm_assigner::zkevm_circuit,
+        spilled_table<nil::marshalling::option::big_endian,
+                      typename single_thread_runner<BlueprintFieldType>::ArithmetizationType>>;
+
+    block_pipeline(single_thread_runner<BlueprintFieldType>& runner,
+                   pipeline_options options = {})
+        : m_runner(runner), m_options(options) {}
+
+    /// @brief Check of the tables of a block, e.g. satisfiability, returned error stops the
+    /// pipeline
+    using table_check_type =
+        std::function<std::optional<std::string>(std::size_t index, const assignments_type&)>;
+
+    /// @brief Run the check on tables of every block before they are serialized or spilled.
+    /// Checks run on the serialize stage thread, or on the execute stage one for spilled tables
+    void set_table_check(table_check_type check) { m_table_check = std::move(check); }
+
+    /// @brief Process all blocks, stops on the first error
+    std::optional<std::string> run(const std::vector<block_source>& blocks,
+                                   const std::string& assignment_table_file_name,
+                                   const std::optional<OutputArtifacts>& artifacts);
+
+    /// @brief Base name of output files of the block
+    static std::string block_file_name(const std::string& basefilename, std::size_t index);
+
+    /// @brief Approximate memory occupied by the tables
+    static std::size_t estimate_bytes(const assignments_type& assignments);
+
+  private:
+    single_thread_runner<BlueprintFieldType>& m_runner;
+    pipeline_options m_options;
+    table_check_type m_table_check;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_PIPELINE_HPP_
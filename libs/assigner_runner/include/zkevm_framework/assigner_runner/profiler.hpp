@@ -0,0 +1,76 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_PROFILER_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_PROFILER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+/// @brief Total number of bytes allocated by the calling thread. It is advanced by global
+/// operator new of the executable if it installs counting one (assigner does), otherwise it stays
+/// zero. Counter is per thread, so pipeline stages and worker pools don't count into each other.
+std::uint64_t& allocation_counter();
+
+/// @brief Registry of timed execution phases with attached counters
+class profiler {
+  public:
+    enum class output_format { json, chrome };
+
+    struct event {
+        std::string name;
+        std::string category;
+        std::uint64_t thread_id;          // Sequential id of the thread which recorded the event
+        std::chrono::microseconds start;  // Since profiler creation
+        std::chrono::microseconds duration;
+        std::uint64_t allocated_bytes;
+        std::map<std::string, std::int64_t> counters;
+    };
+
+    /// @brief Records event on destruction or on `stop`. Timer without profiler does nothing.
+    /// Allocated bytes are counted on the thread which started the timer, it must be stopped
+    /// there too.
+    class scoped_timer {
+      public:
+        scoped_timer() = default;
+        scoped_timer(profiler* owner, std::string name, std::string category);
+        scoped_timer(const scoped_timer&) = delete;
+        scoped_timer& operator=(const scoped_timer&) = delete;
+        scoped_timer(scoped_timer&& other) noexcept;
+        scoped_timer& operator=(scoped_timer&& other) noexcept;
+        ~scoped_timer();
+
+        void add_counter(const std::string& name, std::int64_t value);
+        void stop();
+
+      private:
+        profiler* m_owner = nullptr;
+        event m_event;
+        std::chrono::steady_clock::time_point m_start;
+        std::uint64_t m_start_allocated = 0;
+    };
+
+    profiler();
+
+    /// @brief Start timer of named phase, `category` groups events of the same kind
+    scoped_timer scope(std::string name, std::string category = "phase");
+
+    std::vector<event> events() const;
+
+    /// @brief Write collected events to file as plain JSON or in Chrome trace event format
+    std::optional<std::string> dump(const std::string& file_name, output_format format) const;
+
+    static std::optional<output_format> parse_format(const std::string& name);
+
+  private:
+    void record(event e);
+
+    const std::chrono::steady_clock::time_point m_origin;
+    mutable std::mutex m_mutex;
+    std::vector<event> m_events;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_PROFILER_HPP_
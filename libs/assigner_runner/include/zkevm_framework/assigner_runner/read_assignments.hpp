@@ -0,0 +1,426 @@
+/**
+ * @file read_assignments.hpp
+ *
+ * @brief This file defines reader of assignment tables written in binary mode.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_READ_ASSIGNMENTS_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_READ_ASSIGNMENTS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nil/crypto3/marshalling/algebra/types/field_element.hpp"
+#include "nil/marshalling/types/integral.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+
+/**
+ * @brief Binary assignment table in plain or compact format.
+ *
+ * Loading parses only layout of the columns, cells are decoded on access: plain cells are read
+ * in place, bit-packed cells are single bits and run-length encoded cells are found by binary
+ * search over runs of the column.
+ */
+template<typename Endianness, typename BlueprintFieldType>
+class binary_table_reader {
+  public:
+    using value_type = typename BlueprintFieldType::value_type;
+
+    /// @brief Parse table layout. Content is not copied, it must outlive the reader: a buffer
+    /// or a file mapped by `mapped_file::open`.
+    std::optional<std::string> load(std::string_view content) {
+        m_content = content;
+        m_pos = 0;
+        m_witnesses.clear();
+        m_public_inputs.clear();
+        m_constants.clear();
+        m_selectors.clear();
+
+        m_format = table_format::plain;
+        if (m_content.size() >= kCompactTableMagic.size() &&
+            std::memcmp(m_content.data(), kCompactTableMagic.data(),
+                        kCompactTableMagic.size()) == 0) {
+            m_format = table_format::compact;
+            m_pos = kCompactTableMagic.size();
+        }
+
+        std::size_t sizes[6];
+        for (auto& size : sizes) {
+            auto err = read_size(size);
+            if (err) {
+                return err;
+            }
+        }
+        m_usable_rows = sizes[4];
+        m_padded_rows = sizes[5];
+        if (m_padded_rows == 0 || m_usable_rows > m_padded_rows) {
+            return "Invalid table rows amount";
+        }
+
+        const std::pair<std::vector<column>*, std::size_t> sections[] = {
+            {&m_witnesses, sizes[0]},
+            {&m_public_inputs, sizes[1]},
+            {&m_constants, sizes[2]},
+            {&m_selectors, sizes[3]}};
+        for (const auto& [columns, amount] : sections) {
+            auto err = m_format == table_format::compact ? parse_compact_section(*columns, amount)
+                                                         : parse_plain_section(*columns, amount);
+            if (err) {
+                return err;
+            }
+        }
+        if (m_pos != m_content.size()) {
+            return "Unexpected data after the table";
+        }
+        return {};
+    }
+
+    table_format format() const { return m_format; }
+    std::size_t witnesses_amount() const { return m_witnesses.size(); }
+    std::size_t public_inputs_amount() const { return m_public_inputs.size(); }
+    std::size_t constants_amount() const { return m_constants.size(); }
+    std::size_t selectors_amount() const { return m_selectors.size(); }
+    std::size_t usable_rows() const { return m_usable_rows; }
+    std::size_t padded_rows() const { return m_padded_rows; }
+
+    value_type witness(std::size_t index, std::size_t row) const {
+        return value(m_witnesses.at(index), row);
+    }
+    value_type public_input(std::size_t index, std::size_t row) const {
+        return value(m_public_inputs.at(index), row);
+    }
+    value_type constant(std::size_t index, std::size_t row) const {
+        return value(m_constants.at(index), row);
+    }
+    value_type selector(std::size_t index, std::size_t row) const {
+        return value(m_selectors.at(index), row);
+    }
+
+  private:
+    using TTypeBase = nil::marshalling::field_type<Endianness>;
+    using field_element = nil::crypto3::marshalling::types::field_element<TTypeBase, value_type>;
+    using size_element = nil::marshalling::types::integral<TTypeBase, std::size_t>;
+
+    static constexpr std::size_t kFieldSize = field_element().length();
+    static constexpr std::size_t kSizeSize = size_element().length();
+
+    struct run {
+        std::size_t first_row;
+        column_run kind;
+        std::size_t offset;
+    };
+
+    struct column {
+        column_encoding encoding;
+        std::size_t offset;
+        std::vector<run> runs;
+    };
+
+    bool available(std::size_t bytes) const { return bytes <= m_content.size() - m_pos; }
+
+    std::optional<std::string> read_size(std::size_t& result) {
+        if (!available(kSizeSize)) {
+            return "Table is truncated";
+        }
+        size_element container;
+        auto iter = reinterpret_cast<const std::uint8_t*>(m_content.data()) + m_pos;
+        if (container.read(iter, kSizeSize) != nil::marshalling::status_type::success) {
+            return "Invalid size value";
+        }
+        result = container.value();
+        m_pos += kSizeSize;
+        return {};
+    }
+
+    std::optional<std::string> skip_fields(std::size_t amount) {
+        if (amount > (m_content.size() - m_pos) / kFieldSize) {
+            return "Table is truncated";
+        }
+        m_pos += amount * kFieldSize;
+        return {};
+    }
+
+    std::optional<std::string> parse_plain_section(std::vector<column>& columns,
+                                                   std::size_t amount) {
+        std::size_t cells = 0;
+        auto err = read_size(cells);
+        if (err) {
+            return err;
+        }
+        if (amount != 0 && (cells % amount != 0 || cells / amount != m_padded_rows)) {
+            return "Invalid size of columns section";
+        }
+        for (std::size_t i = 0; i < amount; i++) {
+            columns.push_back({column_encoding::plain, m_pos, {}});
+            err = skip_fields(m_padded_rows);
+            if (err) {
+                return err;
+            }
+        }
+        return {};
+    }
+
+    std::optional<std::string> parse_compact_section(std::vector<column>& columns,
+                                                     std::size_t amount) {
+        for (std::size_t i = 0; i < amount; i++) {
+            if (!available(1)) {
+                return "Table is truncated";
+            }
+            column col{static_cast<column_encoding>(m_content[m_pos++]), m_pos, {}};
+            std::optional<std::string> err;
+            switch (col.encoding) {
+                case column_encoding::plain:
+                    err = skip_fields(m_padded_rows);
+                    break;
+                case column_encoding::bits:
+                    if (!available((m_padded_rows + 7) / 8)) {
+                        return "Table is truncated";
+                    }
+                    m_pos += (m_padded_rows + 7) / 8;
+                    break;
+                case column_encoding::runs:
+                    err = parse_runs(col.runs);
+                    break;
+                default:
+                    return "Unknown column encoding";
+            }
+            if (err) {
+                return err;
+            }
+            columns.push_back(std::move(col));
+        }
+        return {};
+    }
+
+    std::optional<std::string> parse_runs(std::vector<run>& runs) {
+        for (std::size_t row = 0; row < m_padded_rows;) {
+            std::size_t length = 0;
+            auto err = read_size(length);
+            if (err) {
+                return err;
+            }
+            if (length == 0 || length > m_padded_rows - row || !available(1)) {
+                return "Invalid column run";
+            }
+            const auto kind = static_cast<column_run>(m_content[m_pos++]);
+            runs.push_back({row, kind, m_pos});
+            switch (kind) {
+                case column_run::zeros:
+                    break;
+                case column_run::repeat:
+                    err = skip_fields(1);
+                    break;
+                case column_run::literal:
+                    err = skip_fields(length);
+                    break;
+                default:
+                    return "Unknown column run";
+            }
+            if (err) {
+                return err;
+            }
+            row += length;
+        }
+        return {};
+    }
+
+    value_type read_field(std::size_t offset) const {
+        field_element container;
+        auto iter = reinterpret_cast<const std::uint8_t*>(m_content.data()) + offset;
+        container.read(iter, kFieldSize);
+        return container.value();
+    }
+
+    value_type value(const column& col, std::size_t row) const {
+        if (row >= m_padded_rows) {
+            throw std::out_of_range("Row is out of table");
+        }
+        switch (col.encoding) {
+            case column_encoding::plain:
+                return read_field(col.offset + row * kFieldSize);
+            case column_encoding::bits:
+                return (static_cast<std::uint8_t>(m_content[col.offset + row / 8]) >> (row % 8)) & 1
+                           ? value_type::one()
+                           : value_type::zero();
+            case column_encoding::runs:
+                break;
+        }
+        auto it = std::upper_bound(
+            col.runs.begin(), col.runs.end(), row,
+            [](std::size_t r, const run& current) { return r < current.first_row; });
+        --it;
+        switch (it->kind) {
+            case column_run::zeros:
+                return value_type::zero();
+            case column_run::repeat:
+                return read_field(it->offset);
+            case column_run::literal:
+                break;
+        }
+        return read_field(it->offset + (row - it->first_row) * kFieldSize);
+    }
+
+    std::string_view m_content;
+    std::size_t m_pos = 0;
+    table_format m_format = table_format::plain;
+    std::size_t m_usable_rows = 0;
+    std::size_t m_padded_rows = 0;
+    std::vector<column> m_witnesses;
+    std::vector<column> m_public_inputs;
+    std::vector<column> m_constants;
+    std::vector<column> m_selectors;
+};
+
+/**
+ * @brief Read binary assignment table file, chunked compressed files are decompressed.
+ */
+inline std::optional<std::string> read_table_file(const std::string& filename,
+                                                  std::string& content) {
+    std::ifstream fin(filename, std::ios_base::binary | std::ios_base::in);
+    if (!fin.is_open()) {
+        return "Cannot open " + filename;
+    }
+    for (const auto codec : {compression_codec::gzip, compression_codec::zstd}) {
+        if (filename.ends_with(compression_suffix(codec))) {
+            chunked_decompressor reader;
+            auto err = reader.open(fin);
+            if (err) {
+                return filename + ": " + *err;
+            }
+            err = reader.read(0, reader.size(), content);
+            if (err) {
+                return filename + ": " + *err;
+            }
+            return {};
+        }
+    }
+    content.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+    if (fin.bad()) {
+        return "Failed to read " + filename;
+    }
+    return {};
+}
+
+/**
+ * @brief Restore table written by `write_binary_assignment_shared` from its per block part and
+ * shared static columns. Result is the same as written by `write_binary_assignment`.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType>
+std::optional<std::string> restore_shared_assignment(std::string_view block,
+                                                     std::string_view static_table,
+                                                     std::string& table) {
+    using reader_type = binary_table_reader<Endianness, BlueprintFieldType>;
+    using size_element = nil::marshalling::types::integral<
+        nil::marshalling::field_type<Endianness>, std::size_t>;
+    constexpr std::size_t kSizeSize = size_element().length();
+    // Trailer of the block part is `begin` followed by the hash of static columns
+    constexpr std::size_t kTrailerSize = kSizeSize + kStaticColumnsDigestSize;
+
+    std::size_t header_offset = 0;
+    if (block.starts_with(std::string_view(reinterpret_cast<const char*>(kCompactTableMagic.data()),
+                                           kCompactTableMagic.size()))) {
+        header_offset = kCompactTableMagic.size();
+    }
+    if (block.size() < header_offset + 6 * kSizeSize + kTrailerSize) {
+        return "Table is truncated";
+    }
+    auto read_size = [&](std::size_t offset) {
+        size_element container;
+        auto iter = reinterpret_cast<const std::uint8_t*>(block.data()) + offset;
+        container.read(iter, kSizeSize);
+        return container.value();
+    };
+    const std::size_t trailer_offset = block.size() - kTrailerSize;
+    const std::size_t constants_amount = read_size(header_offset + 2 * kSizeSize);
+    const std::size_t selectors_amount = read_size(header_offset + 3 * kSizeSize);
+    const std::size_t usable_rows_amount = read_size(header_offset + 4 * kSizeSize);
+    const std::size_t begin = read_size(trailer_offset);
+
+    const auto digest = core::mpt::Keccak256Hasher().Hash(std::as_bytes(std::span(static_table)));
+    if (std::memcmp(digest.bytes().data(), block.data() + trailer_offset + kSizeSize,
+                    kStaticColumnsDigestSize) != 0) {
+        return "Static columns don't match the table";
+    }
+    reader_type reader;
+    auto err = reader.load(static_table);
+    if (err) {
+        return "Invalid static columns: " + *err;
+    }
+    if (reader.format() != (header_offset != 0 ? table_format::compact : table_format::plain) ||
+        reader.constants_amount() != constants_amount ||
+        reader.selectors_amount() != selectors_amount) {
+        return "Static columns don't match the table";
+    }
+
+    struct static_column {
+        const reader_type& reader;
+        bool selector;
+        std::size_t index;
+
+        std::size_t size() const { return reader.usable_rows(); }
+        typename reader_type::value_type operator[](std::size_t row) const {
+            return selector ? reader.selector(index, row) : reader.constant(index, row);
+        }
+    };
+    struct static_table_view {
+        const reader_type& reader;
+
+        std::uint32_t constants_amount() const { return reader.constants_amount(); }
+        std::uint32_t selectors_amount() const { return reader.selectors_amount(); }
+        static_column constant(std::uint32_t i) const { return {reader, false, i}; }
+        static_column selector(std::uint32_t i) const { return {reader, true, i}; }
+    };
+
+    std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+    out.write(block.data(), static_cast<std::streamsize>(trailer_offset));
+    write_binary_static_columns<Endianness, ArithmetizationType, BlueprintFieldType>(
+        static_table_view{reader}, begin, begin + usable_rows_amount, out, reader.format());
+    table = std::move(out).str();
+    return {};
+}
+
+/**
+ * @brief Restore table from a file written with shared static columns, the static columns file
+ * is looked up next to it by the hash stored in the table.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType>
+std::optional<std::string> restore_shared_assignment_file(const std::string& filename,
+                                                          std::string& table) {
+    std::string block;
+    auto err = read_table_file(filename, block);
+    if (err) {
+        return err;
+    }
+    if (block.size() < kStaticColumnsDigestSize) {
+        return "Table is truncated";
+    }
+    auto codec = compression_codec::none;
+    for (const auto candidate : {compression_codec::gzip, compression_codec::zstd}) {
+        if (filename.ends_with(compression_suffix(candidate))) {
+            codec = candidate;
+        }
+    }
+    static_columns shared;
+    shared.digest = core::mpt::NodeKey(
+        std::as_bytes(std::span(block).last(kStaticColumnsDigestSize)));
+    std::string static_table;
+    err = read_table_file(shared.filename(filename, codec), static_table);
+    if (err) {
+        return err;
+    }
+    return restore_shared_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+        block, static_table, table);
+}
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_READ_ASSIGNMENTS_HPP_
@@ -0,0 +1,80 @@
+/**
+ * @file row_estimator.hpp
+ *
+ * @brief Estimate of assignment table rows of a block computed before its execution.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_ROW_ESTIMATOR_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_ROW_ESTIMATOR_HPP_
+
+#include <assigner.hpp>
+#include <vm_host.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/input_messages.hpp"
+#include "zkevm_framework/core/types/block.hpp"
+#include "zkevm_framework/core/types/message.hpp"
+
+/// @brief Rows of a circuit as a linear function of block features
+struct row_model {
+    double base = 0;
+    double per_message = 0;
+    double per_contract = 0;
+    double per_code_byte = 0;
+    double per_gas = 0;
+};
+
+struct row_estimate {
+    /// @brief Block features the estimate is based on
+    std::size_t messages = 0;
+    std::size_t contracts = 0;
+    std::size_t code_bytes = 0;
+    std::uint64_t gas = 0;
+
+    /// @brief Estimated rows by circuit, circuits without a model are absent
+    std::unordered_map<nil::evm_assigner::zkevm_circuit, std::size_t> rows;
+
+    /// @brief Error if some circuit is estimated to take more than `max_rows`
+    std::optional<std::string> check_limit(std::size_t max_rows) const;
+};
+
+/**
+ * @brief Cheap pre-pass estimating rows of assignment tables needed by a block.
+ *
+ * Only messages which are executed by the runner are counted. Contracts are distinct codes
+ * called by the block, code of accounts not loaded yet (RPC, lazy storage) is unknown, so the
+ * estimate is a lower bound for such blocks. By default only bytecode circuit is modelled: one
+ * row per code byte plus a header row per contract.
+ */
+class row_estimator {
+  public:
+    row_estimator();
+
+    void set_model(nil::evm_assigner::zkevm_circuit circuit, const row_model& model);
+
+    row_estimate estimate(const core::types::Block& block,
+                          const std::vector<core::types::Message>& messages,
+                          const evmc::accounts& accounts) const;
+
+    row_estimate estimate(const core::types::Block& block, const input_messages& messages,
+                          const evmc::accounts& accounts) const;
+
+  private:
+    template<typename Message>
+    void count_message(const Message& msg, std::uint64_t gas_price,
+                       const evmc::accounts& accounts,
+                       std::unordered_set<std::string_view>& codes, row_estimate& result) const;
+    void apply_models(row_estimate& result) const;
+
+    std::unordered_map<nil::evm_assigner::zkevm_circuit, row_model> m_models;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_ROW_ESTIMATOR_HPP_
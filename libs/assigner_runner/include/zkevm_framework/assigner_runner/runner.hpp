@@ -8,16 +8,30 @@
 #include <unordered_map>
 
 #include "output_artifacts.hpp"
+#include "zkevm_framework/assigner_runner/block_roots.hpp"
+#include "zkevm_framework/assigner_runner/code_cache.hpp"
 #include "zkevm_framework/assigner_runner/ext_vm_host.hpp"
+#include "zkevm_framework/assigner_runner/input_messages.hpp"
+#include "zkevm_framework/assigner_runner/lazy_storage.hpp"
+#include "zkevm_framework/assigner_runner/profiler.hpp"
+#include "zkevm_framework/assigner_runner/row_estimator.hpp"
 #include "zkevm_framework/assigner_runner/utils.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
 #include "zkevm_framework/core/types/block.hpp"
 #include "zkevm_framework/rpc/data_extractor.hpp"
 
+/// @brief Where a block was loaded from. Blocks of JSON files carry no messages root, their
+/// input messages can't be checked against the header
+enum class block_origin { rpc, json_file };
+
 template<typename BlueprintFieldType>
 class single_thread_runner {
   public:
     using ArithmetizationType =
         nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using assignments_type =
+        std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                           nil::blueprint::assignment<ArithmetizationType>>;
 
     /// @brief Initialize runner with empty input block and account storage
     single_thread_runner(
@@ -28,32 +42,140 @@ class single_thread_runner {
         : m_assignments(assignments),
           m_target_circuits(target_circuits),
           m_log_level(log_level),
-          m_extractor("127.0.0.1", 8529, shard_id) {}
+          m_extractor(rpc_endpoint{}, shard_id) {}
 
     /// @brief Execute one block
     std::optional<std::string> run(const std::string& assignment_table_file_name,
                                    const std::optional<OutputArtifacts>& artifacts);
 
+    /// @brief Execute loaded block filling assignment tables without writing them
+    std::optional<std::string> execute();
+
+    /// @brief Execute given block and move filled tables into `assignments`. Runner tables
+    /// are reset to their state before the first executed block, so the next block can be
+    /// executed while tables of this one are being written. Account state is kept.
+    std::optional<std::string> execute_block(core::types::Block block, input_messages messages,
+                                             block_origin origin, assignments_type& assignments);
+
+    /// @brief Write tables in binary format and, if requested, output artifacts
+    std::optional<std::string> write_outputs(
+        const assignments_type& assignments, const std::string& assignment_table_file_name,
+        const std::optional<OutputArtifacts>& artifacts) const;
+
     /// @brief Load account storage from file
     std::optional<std::string> extract_accounts_with_storage(
         const std::string& account_storage_config_name);
 
+    /// @brief Forget all accounts loaded so far, caches of the runner are kept
+    void reset_account_storage() {
+        m_account_storage.clear();
+        if (m_lazy_storage) {
+            m_lazy_storage.emplace(lazy_storage::slot_loader{});
+        }
+    }
+
+    /// @brief Load storage of accounts requested via RPC by slots on the first access. Loaded
+    /// slots are kept across blocks like the accounts themselves.
+    void set_lazy_storage(bool enabled) {
+        if (!enabled) {
+            m_lazy_storage.reset();
+        } else if (!m_lazy_storage) {
+            // Slot loader is set by the host of every block
+            m_lazy_storage.emplace(lazy_storage::slot_loader{});
+        }
+    }
+
+    /// @brief Lazily loaded storage, nullptr if it is not enabled
+    const lazy_storage* get_lazy_storage() const {
+        return m_lazy_storage ? &m_lazy_storage.value() : nullptr;
+    }
+
+    /// @brief Node queried for blocks and accounts, 127.0.0.1:8529 by default
+    void set_rpc_endpoint(const rpc_endpoint& endpoint) {
+        m_extractor = data_extractor(endpoint, m_extractor.shard_id());
+    }
+
+    /// @brief Check input messages of every block against `m_in_messages_root` of its header
+    /// before execution. Disabled by default: the trie layout is not verified against roots of
+    /// real node blocks yet. Blocks loaded from JSON files are not checked.
+    void set_check_messages_root(bool enabled) { m_check_messages_root = enabled; }
+
+    /// @brief Compute SSZ roots of every executed block and its input messages
+    void set_record_block_roots(bool enabled) { m_record_block_roots = enabled; }
+
+    /// @brief Fail a block before execution if its roots differ from roots at the same position
+    /// of the sequence. Roots are recorded then as well.
+    void set_expected_block_roots(std::vector<block_roots> roots) {
+        m_expected_block_roots = std::move(roots);
+    }
+
+    /// @brief Roots of executed blocks in order of execution
+    const std::vector<block_roots>& get_block_roots() const { return m_block_roots; }
+
+    /// @brief Fail a block if some of its tables needs more rows, checked against the row
+    /// estimate before execution and against the filled tables after it
+    void set_max_rows(std::optional<std::size_t> max_rows) { m_max_rows = max_rows; }
+
+    /// @brief Split binary tables into row segments, see `table_output_options`
+    void set_table_output_options(const table_output_options& options) {
+        m_table_output_options = options;
+    }
+
+    const table_output_options& get_table_output_options() const {
+        return m_table_output_options;
+    }
+
+    /// @brief Estimator of table rows, its models may be tuned
+    row_estimator& get_row_estimator() { return m_row_estimator; }
+
+    /// @brief Record phase and per-message timings into the profiler, nullptr disables profiling
+    void set_profiler(profiler* prof) { m_profiler = prof; }
+
     /// @brief Load input block with messages from RPC or file
     std::optional<std::string> extract_block_with_messages(const std::string& blockHash,
                                                            const std::string& block_file_name);
 
+    /// @brief Load block with messages from RPC or file without changing runner state. Safe to
+    /// call concurrently with block execution.
+    std::optional<std::string> load_block(const std::string& blockHash,
+                                          const std::string& block_file_name,
+                                          core::types::Block& block, input_messages& messages,
+                                          block_origin& origin) const;
+
+    profiler* get_profiler() const { return m_profiler; }
+
   private:
     std::optional<std::string> fill_assignments();
+    profiler::scoped_timer profile_scope(std::string name,
+                                         std::string category = "phase") const;
 
     std::unordered_map<nil::evm_assigner::zkevm_circuit,
                        nil::blueprint::assignment<ArithmetizationType>>& m_assignments;
+    // Tables as they were before the first block executed by execute_block
+    std::optional<assignments_type> m_preset_assignments;
 
     std::vector<std::string> m_target_circuits;
     boost::log::trivial::severity_level m_log_level;
     data_extractor m_extractor;
+    // Kept across blocks with m_account_storage: accounts opened lazily are not fetched again
+    std::optional<lazy_storage> m_lazy_storage;
+    profiler* m_profiler = nullptr;
+    row_estimator m_row_estimator;
+    std::optional<std::size_t> m_max_rows;
+    bool m_check_messages_root = false;
+    bool m_record_block_roots = false;
+    std::optional<std::vector<block_roots>> m_expected_block_roots;
+    std::vector<block_roots> m_block_roots;
+    table_output_options m_table_output_options;
+    // Caches are shared by all blocks executed by the runner
+    code_cache m_code_cache;
+    mutable static_columns_cache<nil::marshalling::option::big_endian, ArithmetizationType,
+                                 BlueprintFieldType>
+        m_static_columns_cache;
     evmc::accounts m_account_storage;
     core::types::Block m_current_block;
-    std::vector<core::types::Message> m_input_messages;
+    block_origin m_current_block_origin = block_origin::rpc;
+    input_messages m_input_messages;
 };
 
 #endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_RUNNER_HPP_
@@ -0,0 +1,173 @@
+/**
+ * @file spilled_table.hpp
+ *
+ * @brief Read-only assignment tables stored in memory mapped temporary files.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_SPILLED_TABLE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_SPILLED_TABLE_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nil/blueprint/blueprint/plonk/assignment.hpp"
+#include "nil/crypto3/marshalling/algebra/types/field_element.hpp"
+#include "zkevm_framework/assigner_runner/mapped_file.hpp"
+
+/**
+ * @brief Column of spilled table. Cells are kept in their binary table encoding and decoded on
+ * access, the view is cheap to copy and valid while the table is alive.
+ */
+template<typename Endianness, typename ArithmetizationType>
+class mapped_column {
+  public:
+    using value_type =
+        typename nil::blueprint::assignment<ArithmetizationType>::field_type::value_type;
+    using field_element =
+        nil::crypto3::marshalling::types::field_element<nil::marshalling::field_type<Endianness>,
+                                                        value_type>;
+
+    static constexpr std::size_t kCellSize = field_element().length();
+
+    mapped_column() = default;
+    mapped_column(const std::uint8_t* data, std::size_t size) : m_data(data), m_size(size) {}
+
+    std::size_t size() const { return m_size; }
+
+    value_type operator[](std::size_t row) const {
+        assert(row < m_size);
+        field_element cell;
+        auto read_iter = m_data + row * kCellSize;
+        const auto status = cell.read(read_iter, kCellSize);
+        assert(status == nil::marshalling::status_type::success);
+        (void)status;
+        return cell.value();
+    }
+
+    /// @brief Encoded cells of rows [begin, end)
+    std::span<const std::uint8_t> cells(std::size_t begin, std::size_t end) const {
+        assert(begin <= end && end <= m_size);
+        return {m_data + begin * kCellSize, (end - begin) * kCellSize};
+    }
+
+  private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+/**
+ * @brief Completed assignment table moved out of memory into a temporary file.
+ *
+ * Provides the column accessors of nil::blueprint::assignment used by table writers, so
+ * `write_binary_assignment` and `compute_table_digest` read cells directly from mapped pages.
+ * Pages are loaded on access and can be evicted by the system, so resident memory of the table
+ * is not bounded by its size. The table is spilled only once it is completed, it must fit into
+ * memory while it is filled.
+ */
+template<typename Endianness, typename ArithmetizationType>
+class spilled_table {
+  public:
+    using column_type = mapped_column<Endianness, ArithmetizationType>;
+
+    /**
+     * @brief Write all columns of the table into a temporary file in `directory` and release
+     * the table.
+     */
+    static std::optional<std::string> spill(
+        nil::blueprint::assignment<ArithmetizationType>&& table, const std::string& directory,
+        spilled_table& result) {
+        result = {};
+        auto err = result.m_file.create(directory);
+        if (err) {
+            return err;
+        }
+        std::vector<std::uint8_t> buffer;
+        auto append_columns = [&](section kind, std::uint32_t amount, auto get_column) {
+            for (std::uint32_t i = 0; i < amount && !err; i++) {
+                const auto& column = get_column(i);
+                buffer.resize(column.size() * column_type::kCellSize);
+                auto write_iter = buffer.begin();
+                for (const auto& value : column) {
+                    const typename column_type::field_element cell(value);
+                    const auto status = cell.write(write_iter, column_type::kCellSize);
+                    assert(status == nil::marshalling::status_type::success);
+                    (void)status;
+                }
+                result.m_columns[kind].push_back(
+                    {result.m_file.size(), static_cast<std::uint32_t>(column.size())});
+                err = result.m_file.append(buffer);
+            }
+        };
+        const auto& source = table;
+        append_columns(witness_section, source.witnesses_amount(),
+                       [&](std::uint32_t i) -> decltype(auto) { return source.witness(i); });
+        append_columns(public_input_section, source.public_inputs_amount(),
+                       [&](std::uint32_t i) -> decltype(auto) { return source.public_input(i); });
+        append_columns(constant_section, source.constants_amount(),
+                       [&](std::uint32_t i) -> decltype(auto) { return source.constant(i); });
+        append_columns(selector_section, source.selectors_amount(),
+                       [&](std::uint32_t i) -> decltype(auto) { return source.selector(i); });
+        if (err) {
+            return err;
+        }
+        // Table is released before mapping, so the peak is one copy of the table
+        { auto released = std::move(table); }
+        return result.m_file.map();
+    }
+
+    std::uint32_t witnesses_amount() const { return m_columns[witness_section].size(); }
+    std::uint32_t public_inputs_amount() const { return m_columns[public_input_section].size(); }
+    std::uint32_t constants_amount() const { return m_columns[constant_section].size(); }
+    std::uint32_t selectors_amount() const { return m_columns[selector_section].size(); }
+
+    std::uint32_t witness_column_size(std::uint32_t i) const {
+        return m_columns[witness_section][i].size;
+    }
+    std::uint32_t public_input_column_size(std::uint32_t i) const {
+        return m_columns[public_input_section][i].size;
+    }
+    std::uint32_t constant_column_size(std::uint32_t i) const {
+        return m_columns[constant_section][i].size;
+    }
+    std::uint32_t selector_column_size(std::uint32_t i) const {
+        return m_columns[selector_section][i].size;
+    }
+
+    column_type witness(std::uint32_t i) const { return column(witness_section, i); }
+    column_type public_input(std::uint32_t i) const { return column(public_input_section, i); }
+    column_type constant(std::uint32_t i) const { return column(constant_section, i); }
+    column_type selector(std::uint32_t i) const { return column(selector_section, i); }
+
+    /// @brief Size of the temporary file
+    std::size_t bytes() const { return m_file.size(); }
+
+  private:
+    enum section : std::size_t {
+        witness_section = 0,
+        public_input_section = 1,
+        constant_section = 2,
+        selector_section = 3,
+    };
+
+    struct column_location {
+        std::size_t offset;
+        std::uint32_t size;
+    };
+
+    column_type column(section kind, std::uint32_t i) const {
+        const auto& location = m_columns[kind][i];
+        return {m_file.data() + location.offset, location.size};
+    }
+
+    mapped_file m_file;
+    std::array<std::vector<column_location>, 4> m_columns;
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_SPILLED_TABLE_HPP_
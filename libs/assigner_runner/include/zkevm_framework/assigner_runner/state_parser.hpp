@@ -6,6 +6,7 @@
 #include <string>
 
 #include "vm_host.hpp"
+#include "zkevm_framework/core/common.hpp"
 
 /// @brief Fill account storage by config from input stream
 std::optional<std::string> init_account_storage(evmc::accounts &account_storage,
@@ -19,4 +20,11 @@ std::optional<std::string> init_account_storage(evmc::accounts &account_storage,
 std::optional<std::string> load_account_with_storage(evmc::account &account,
                                                      std::istream &account_data);
 
+/// @brief Fill account from RPC response without storage, which is loaded lazily by slots
+std::optional<std::string> load_account(evmc::account &account, core::Hash &storage_root,
+                                        std::istream &account_data);
+
+/// @brief Parse storage slot value from RPC response
+std::optional<std::string> load_storage_slot(evmc::bytes32 &value, std::istream &slot_data);
+
 #endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_STATE_PARSER_HPP_
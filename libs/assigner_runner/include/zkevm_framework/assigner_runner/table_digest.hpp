@@ -0,0 +1,66 @@
+/**
+ * @file table_digest.hpp
+ *
+ * @brief Content digest of assignment tables for detecting changes of assignments.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_TABLE_DIGEST_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_TABLE_DIGEST_HPP_
+
+#include <cstddef>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "zkevm_framework/core/mpt/node_key.hpp"
+
+struct digest_options {
+    /// @brief Rows hashed as one chunk
+    std::size_t chunk_rows = 4096;
+    /// @brief Number of hashing threads, 0 means hardware concurrency
+    std::size_t threads = 0;
+};
+
+/// @brief Two-level Keccak-256 tree of a column: chunks of rows are hashed independently and
+/// the column digest is the hash of chunk digests
+struct column_digest {
+    /// @brief witnessN, public_inputN, constantN or selectorN
+    std::string name;
+    core::mpt::NodeKey digest;
+    std::vector<core::mpt::NodeKey> chunks;
+};
+
+/// @brief Digests of all columns of assignment table over its usable rows
+struct table_digest {
+    std::size_t usable_rows = 0;
+    std::size_t chunk_rows = 0;
+    /// @brief Hash of usable rows, chunk rows and column digests
+    core::mpt::NodeKey digest;
+    std::vector<column_digest> columns;
+
+    /// @brief Serialize into JSON manifest
+    std::string to_json(std::size_t circuit) const;
+
+    /// @brief Parse JSON manifest
+    static std::optional<std::string> from_json(const std::string& json, table_digest& result);
+
+    /// @brief Describe every column and chunk of rows differing from `expected`, empty if
+    /// tables are the same
+    std::vector<std::string> compare(const table_digest& expected) const;
+};
+
+/**
+ * @brief Compute digest of assignment table hashing chunks of all columns concurrently. Cells
+ * are hashed in their binary table encoding, short columns are padded with zeros up to usable
+ * rows. Instantiated for nil::blueprint::assignment and `spilled_table` of the field.
+ */
+template<typename BlueprintFieldType, typename TableType>
+table_digest compute_table_digest(const TableType& table, const digest_options& options = {});
+
+/// @brief Name of digest manifest of the table written into `table_filename`
+inline std::string digest_manifest_name(const std::string& table_filename) {
+    return table_filename + ".digest.json";
+}
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_TABLE_DIGEST_HPP_
@@ -0,0 +1,154 @@
+/**
+ * @file text_export.hpp
+ *
+ * @brief Readable text export of assignment tables formatted in parallel blocks of rows.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_TEXT_EXPORT_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_TEXT_EXPORT_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "output_artifacts.hpp"
+
+struct text_export_options {
+    /// @brief Rows formatted by one task
+    std::size_t block_rows = 4096;
+    /// @brief Number of formatting threads, 0 means hardware concurrency
+    std::size_t threads = 0;
+    /// @brief Compress output with gzip. Each block is a separate gzip member, their
+    /// concatenation is a valid gzip stream.
+    bool gzip = false;
+};
+
+/// @brief Compress data into a single gzip member
+inline std::string gzip_compress(const std::string& data) {
+    std::string compressed;
+    {
+        boost::iostreams::filtering_ostream out;
+        out.push(boost::iostreams::gzip_compressor());
+        out.push(boost::iostreams::back_inserter(compressed));
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    return compressed;
+}
+
+/**
+ * @brief Export table in text format formatting blocks of rows concurrently.
+ *
+ * `TableType` is `nil::blueprint::assignment` or anything with the same `export_table` and
+ * `max_size` methods.
+ *
+ * Output is the same as of `assignment::export_table` for the whole rows selection. Blocks are
+ * formatted by `export_table` into separate buffers and written in order. The header printed
+ * by `export_table` before the rows is detected once and kept only in the first block. Empty
+ * rows selection is concretized up to `max_size()` like open row ranges. Only a bounded window
+ * of blocks is buffered at a time.
+ */
+template<typename TableType>
+void export_table_parallel(const TableType& table, std::ostream& out,
+                           const Ranges::ConcreteRanges& witnesses,
+                           const Ranges::ConcreteRanges& public_inputs,
+                           const Ranges::ConcreteRanges& constants,
+                           const Ranges::ConcreteRanges& selectors,
+                           const Ranges::ConcreteRanges& rows,
+                           const text_export_options& options = {}) {
+    auto format = [&](const Ranges::ConcreteRanges& block_rows) {
+        std::ostringstream buffer;
+        table.export_table(buffer, witnesses, public_inputs, constants, selectors, block_rows);
+        return std::move(buffer).str();
+    };
+    auto write = [&](const std::string& text) {
+        if (options.gzip) {
+            const auto compressed = gzip_compress(text);
+            out.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+        } else {
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+    };
+
+    Ranges::ConcreteRanges selected = rows;
+    if (selected.empty()) {
+        if (table.max_size() == 0) {
+            write(format(rows));
+            return;
+        }
+        selected.emplace_back(0, table.max_size() - 1);
+    }
+
+    // Exporting a row once and twice tells the length of the header: with `H` header and
+    // `R` row the outputs are `HR` and `HRR`. This assumes `export_table` prints a header which
+    // does not depend on the rows selection followed by the selected rows in order, repeated
+    // rows printed again, as `assignment::export_table` does (checked by text_export_test).
+    // Outputs of another shape leave the header unknown and the table is exported serially.
+    const std::size_t first_row = selected.front().first;
+    const auto once = format({{first_row, first_row}});
+    const auto twice = format({{first_row, first_row}, {first_row, first_row}});
+    std::optional<std::size_t> header_size;
+    if (twice.size() >= once.size() && 2 * once.size() >= twice.size() &&
+        twice.starts_with(once)) {
+        header_size = 2 * once.size() - twice.size();
+    }
+
+    std::vector<Ranges::ConcreteRanges> blocks;
+    const std::size_t block_rows = std::max<std::size_t>(options.block_rows, 1);
+    for (const auto& [lower, upper] : selected) {
+        for (std::size_t begin = lower; begin <= upper; begin += block_rows) {
+            blocks.push_back({{begin, std::min(upper, begin + block_rows - 1)}});
+            if (upper - begin < block_rows) {
+                break;
+            }
+        }
+    }
+    if (!header_size || blocks.size() == 1) {
+        write(format(rows));
+        return;
+    }
+
+    const std::size_t threads =
+        options.threads != 0 ? options.threads
+                             : std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    const std::size_t window = threads * 2;
+    std::vector<std::string> buffers(window);
+    for (std::size_t start = 0; start < blocks.size(); start += window) {
+        const std::size_t count = std::min(window, blocks.size() - start);
+        std::atomic<std::size_t> next = 0;
+        auto worker = [&] {
+            for (auto i = next++; i < count; i = next++) {
+                const auto index = start + i;
+                buffers[i] = format(blocks[index]);
+                if (index != 0) {
+                    buffers[i].erase(0, *header_size);
+                }
+                if (options.gzip) {
+                    buffers[i] = gzip_compress(buffers[i]);
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        for (std::size_t t = 1; t < std::min(threads, count); ++t) {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& w : workers) {
+            w.join();
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            out.write(buffers[i].data(), static_cast<std::streamsize>(buffers[i].size()));
+            buffers[i].clear();
+        }
+    }
+}
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_TEXT_EXPORT_HPP_
@@ -0,0 +1,80 @@
+/**
+ * @file workload_generator.hpp
+ *
+ * @brief Offline generator of synthetic blocks and matching account states.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WORKLOAD_GENERATOR_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WORKLOAD_GENERATOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Kinds of generated contracts. Contracts are assembled by the generator, so no
+ * compiler or cluster is needed.
+ */
+enum class workload_contract : std::size_t {
+    /// @brief Increments storage slot 0
+    counter = 0,
+    /// @brief Stores every 32-byte word of calldata into the slot keyed by its offset
+    storage = 1,
+    /// @brief Stores Keccak-256 of calldata into slot 0
+    hasher = 2,
+    /// @brief Runs arithmetic loop, number of iterations is the first word of calldata
+    arithmetic = 3,
+};
+
+constexpr std::size_t kWorkloadContractKinds = 4;
+
+/// @brief Name of contract kind used in contract mix
+std::string to_string(workload_contract kind);
+
+struct workload_options {
+    std::size_t blocks = 1;
+    std::size_t messages_per_block = 16;
+    /// @brief Relative share of messages calling each contract kind
+    std::array<std::size_t, kWorkloadContractKinds> contract_mix = {1, 1, 1, 1};
+    /// @brief Deployed contracts of each kind
+    std::size_t contracts_per_kind = 4;
+    /// @brief Calldata size of every message, at least one byte
+    std::size_t calldata_bytes = 64;
+    /// @brief Storage slots initialized in every contract
+    std::size_t storage_slots = 16;
+    /// @brief Iterations of arithmetic contract loop
+    std::size_t loop_iterations = 64;
+    std::uint64_t seed = 1;
+
+    /**
+     * @brief Parse contract mix in format `kind:weight(,kind:weight)*`, e.g.
+     * `counter:2,hasher:1`. Missing kinds get zero weight.
+     */
+    static std::expected<std::array<std::size_t, kWorkloadContractKinds>, std::string>
+    parse_contract_mix(const std::string& mix);
+};
+
+/// @brief Generated blocks in the format of block files and account state in the format of
+/// account storage config
+struct workload {
+    std::vector<std::string> blocks;
+    std::string state;
+    std::size_t messages = 0;
+};
+
+/**
+ * @brief Deterministically generate blocks with messages calling contracts of the state.
+ */
+std::expected<workload, std::string> generate_workload(const workload_options& options);
+
+/**
+ * @brief Write blocks into `directory/block<i>.json` and state into `directory/state.json`.
+ */
+std::optional<std::string> write_workload(const workload& generated,
+                                          const std::string& directory);
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WORKLOAD_GENERATOR_HPP_
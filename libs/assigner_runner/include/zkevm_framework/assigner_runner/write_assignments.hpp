@@ -7,13 +7,23 @@
 #ifndef ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WRITE_ASSIGNMENTS_HPP_
 #define ZKEMV_FRAMEWORK_LIBS_ASSIGNER_RUNNER_INCLUDE_ZKEVM_FRAMEWORK_ASSIGNER_RUNNER_WRITE_ASSIGNMENTS_HPP_
 
+#include <algorithm>
 #include <array>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/serialize.hpp>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <optional>
+#include <random>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -22,6 +32,11 @@
 #include "nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp"
 #include "nil/marshalling/types/integral.hpp"
 #include "output_artifacts.hpp"
+#include "zkevm_framework/assigner_runner/compression.hpp"
+#include "zkevm_framework/assigner_runner/spilled_table.hpp"
+#include "zkevm_framework/assigner_runner/table_digest.hpp"
+#include "zkevm_framework/assigner_runner/text_export.hpp"
+#include "zkevm_framework/core/mpt/hasher.hpp"
 
 /**
  * @brief Write size_t serialized as nil::marshalling::types::integral into output stream.
@@ -32,8 +47,10 @@ void write_size_t(std::size_t input, std::ostream& out) {
     auto integer_container = nil::marshalling::types::integral<TTypeBase, std::size_t>(input);
     std::array<std::uint8_t, integer_container.length()> char_array{};
     auto write_iter = char_array.begin();
-    assert(integer_container.write(write_iter, char_array.size()) ==
-           nil::marshalling::status_type::success);
+    // Write must not be a part of assert expression, it is removed in release builds
+    const auto status = integer_container.write(write_iter, char_array.size());
+    assert(status == nil::marshalling::status_type::success);
+    (void)status;
     out.write(reinterpret_cast<char*>(char_array.data()), char_array.size());
 }
 
@@ -64,8 +81,9 @@ void write_field(
         TTypeBase, typename AssignmentTableType::field_type::value_type>(input);
     std::array<std::uint8_t, field_container.length()> char_array{};
     auto write_iter = char_array.begin();
-    assert(field_container.write(write_iter, char_array.size()) ==
-           nil::marshalling::status_type::success);
+    const auto status = field_container.write(write_iter, char_array.size());
+    assert(status == nil::marshalling::status_type::success);
+    (void)status;
     out.write(reinterpret_cast<char*>(char_array.data()), char_array.size());
 }
 
@@ -75,8 +93,20 @@ void write_field(
 template<typename Endianness, typename ArithmetizationType, typename ColumnType>
 void write_vector_value(const std::size_t padded_rows_amount, const ColumnType& table_col,
                         std::ostream& out) {
-    for (std::size_t i = 0; i < padded_rows_amount; i++) {
-        if (i < table_col.size()) {
+    write_vector_value<Endianness, ArithmetizationType>(0, table_col.size(), padded_rows_amount,
+                                                        table_col, out);
+}
+
+/**
+ * @brief Write rows [begin, end) of table column to output stream padding with zeroes up to
+ * fixed number of values.
+ */
+template<typename Endianness, typename ArithmetizationType, typename ColumnType>
+void write_vector_value(const std::size_t begin, const std::size_t end,
+                        const std::size_t padded_rows_amount, const ColumnType& table_col,
+                        std::ostream& out) {
+    for (std::size_t i = begin; i < begin + padded_rows_amount; i++) {
+        if (i < end && i < table_col.size()) {
             write_field<Endianness, ArithmetizationType>(table_col[i], out);
         } else {
             write_zero_field<Endianness, ArithmetizationType>(out);
@@ -85,48 +115,238 @@ void write_vector_value(const std::size_t padded_rows_amount, const ColumnType&
 }
 
 /**
- * @brief Write assignment table serialized into binary to output stream.
+ * @brief Write rows [begin, end) of spilled table column padding with zeroes. Cells are copied
+ * from mapped pages as is.
  */
-template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType>
-void write_binary_assignment(const nil::blueprint::assignment<ArithmetizationType>& table,
-                             std::ostream& out) {
-    std::uint32_t public_input_size = table.public_inputs_amount();
-    std::uint32_t witness_size = table.witnesses_amount();
-    std::uint32_t constant_size = table.constants_amount();
-    std::uint32_t selector_size = table.selectors_amount();
+template<typename Endianness, typename ArithmetizationType>
+void write_vector_value(const std::size_t begin, const std::size_t end,
+                        const std::size_t padded_rows_amount,
+                        const mapped_column<Endianness, ArithmetizationType>& table_col,
+                        std::ostream& out) {
+    const std::size_t data_begin = std::min(begin, table_col.size());
+    const std::size_t data_end = std::min({end, table_col.size(), begin + padded_rows_amount});
+    if (data_end > data_begin) {
+        const auto cells = table_col.cells(data_begin, data_end);
+        out.write(reinterpret_cast<const char*>(cells.data()),
+                  static_cast<std::streamsize>(cells.size()));
+    }
+    for (std::size_t i = std::max(begin, data_end); i < begin + padded_rows_amount; i++) {
+        write_zero_field<Endianness, ArithmetizationType>(out);
+    }
+}
+
+/**
+ * @brief Number of rows of the table written with given number of usable rows.
+ */
+inline std::size_t padded_rows(std::size_t usable_rows_amount) {
+    std::size_t padded_rows_amount = std::pow(2, std::ceil(std::log2(usable_rows_amount)));
+    if (padded_rows_amount == usable_rows_amount) {
+        padded_rows_amount *= 2;
+    }
+    if (padded_rows_amount < 8) {
+        padded_rows_amount = 8;
+    }
+    return padded_rows_amount;
+}
+
+/**
+ * @brief Max size of witness and public input columns, i.e. rows filled by the assigner.
+ * Constant and selector columns are filled by the circuit preset.
+ */
+template<typename TableType>
+std::size_t filled_rows(const TableType& table) {
+    std::size_t result = 0;
+    for (std::uint32_t i = 0; i < table.witnesses_amount(); i++) {
+        result = std::max<std::size_t>(result, table.witness_column_size(i));
+    }
+    for (std::uint32_t i = 0; i < table.public_inputs_amount(); i++) {
+        result = std::max<std::size_t>(result, table.public_input_column_size(i));
+    }
+    return result;
+}
 
+/**
+ * @brief Max size of table columns. Table is nil::blueprint::assignment or `spilled_table`.
+ */
+template<typename TableType>
+std::size_t usable_rows(const TableType& table) {
     std::uint32_t max_public_inputs_size = 0;
+    std::uint32_t max_witness_size = 0;
     std::uint32_t max_constant_size = 0;
     std::uint32_t max_selector_size = 0;
 
-    for (std::uint32_t i = 0; i < public_input_size; i++) {
+    for (std::uint32_t i = 0; i < table.public_inputs_amount(); i++) {
         max_public_inputs_size =
             std::max(max_public_inputs_size, table.public_input_column_size(i));
     }
-
-    std::uint32_t max_witness_size = 0;
-    for (std::uint32_t i = 0; i < witness_size; i++) {
+    for (std::uint32_t i = 0; i < table.witnesses_amount(); i++) {
         max_witness_size = std::max(max_witness_size, table.witness_column_size(i));
     }
-    for (std::uint32_t i = 0; i < constant_size; i++) {
+    for (std::uint32_t i = 0; i < table.constants_amount(); i++) {
         max_constant_size = std::max(max_constant_size, table.constant_column_size(i));
     }
-    for (std::uint32_t i = 0; i < selector_size; i++) {
+    for (std::uint32_t i = 0; i < table.selectors_amount(); i++) {
         max_selector_size = std::max(max_selector_size, table.selector_column_size(i));
     }
-    std::uint32_t usable_rows_amount =
-        std::max({max_witness_size, max_public_inputs_size, max_constant_size, max_selector_size});
+    return std::max(
+        {max_witness_size, max_public_inputs_size, max_constant_size, max_selector_size});
+}
 
-    std::uint32_t padded_rows_amount = std::pow(2, std::ceil(std::log2(usable_rows_amount)));
-    if (padded_rows_amount == usable_rows_amount) {
-        padded_rows_amount *= 2;
+/**
+ * @brief Format of binary assignment tables.
+ */
+enum class table_format {
+    /// @brief Every cell is a field element
+    plain = 1,
+    /// @brief Columns are bit-packed or run-length encoded, see `write_compact_column`
+    compact = 2,
+};
+
+/// @brief Prefix of compact tables. Plain tables start with the number of witness columns,
+/// which is never that large.
+constexpr std::array<std::uint8_t, 8> kCompactTableMagic = {0xff, 'z', 'k', 't', 'a', 'b', 'l',
+                                                            0x02};
+
+/**
+ * @brief Encoding of a column of compact table.
+ */
+enum class column_encoding : std::uint8_t {
+    /// @brief Field element per row as in plain format
+    plain = 0,
+    /// @brief One bit per row, least significant first, for columns of zeros and ones
+    bits = 1,
+    /// @brief Sequence of runs, see `column_run`
+    runs = 2,
+};
+
+/**
+ * @brief Kind of a run of run-length encoded column. Run is its length followed by the kind
+ * and values: none for zeros, one value for repeat and all values for literal.
+ */
+enum class column_run : std::uint8_t {
+    zeros = 0,
+    repeat = 1,
+    literal = 2,
+};
+
+/**
+ * @brief Write rows [begin, end) of table column padded with zeroes up to fixed number of
+ * values in compact encoding. Columns of zeros and ones are bit-packed unless run-length
+ * encoding is shorter.
+ */
+template<typename Endianness, typename ArithmetizationType, typename ColumnType>
+void write_compact_column(const std::size_t begin, const std::size_t end,
+                          const std::size_t padded_rows_amount, const ColumnType& table_col,
+                          std::ostream& out) {
+    using value_type = typename nil::blueprint::assignment<
+        ArithmetizationType>::field_type::value_type;
+    // Short runs cost more than literal values because they split literals
+    constexpr std::size_t kMinRun = 2;
+
+    const value_type zero = value_type::zero();
+    const value_type one = value_type::one();
+    const std::size_t data_end = std::min(end, std::max<std::size_t>(table_col.size(), begin));
+    const std::size_t last = begin + padded_rows_amount;
+    auto at = [&](std::size_t i) { return i < data_end ? table_col[i] : zero; };
+
+    std::ostringstream runs(std::ios_base::binary | std::ios_base::out);
+    std::size_t literal_begin = begin;
+    auto flush_literals = [&](std::size_t literal_end) {
+        if (literal_end > literal_begin) {
+            write_size_t<Endianness>(literal_end - literal_begin, runs);
+            runs.put(static_cast<char>(column_run::literal));
+            for (std::size_t i = literal_begin; i < literal_end; i++) {
+                write_field<Endianness, ArithmetizationType>(at(i), runs);
+            }
+        }
+    };
+    bool binary = true;
+    for (std::size_t i = begin; i < last;) {
+        const value_type value = at(i);
+        binary = binary && (value == zero || value == one);
+        std::size_t j = i + 1;
+        if (j >= data_end) {
+            // Padding is zero up to the end
+            j = value == zero ? last : j;
+        }
+        while (j < last && at(j) == value) {
+            j = j >= data_end && value == zero ? last : j + 1;
+        }
+        if (j - i >= kMinRun) {
+            flush_literals(i);
+            write_size_t<Endianness>(j - i, runs);
+            if (value == zero) {
+                runs.put(static_cast<char>(column_run::zeros));
+            } else {
+                runs.put(static_cast<char>(column_run::repeat));
+                write_field<Endianness, ArithmetizationType>(value, runs);
+            }
+            literal_begin = j;
+        }
+        i = j;
     }
-    if (padded_rows_amount < 8) {
-        padded_rows_amount = 8;
+    flush_literals(last);
+
+    const std::string encoded_runs = std::move(runs).str();
+    const std::size_t bits_size = (padded_rows_amount + 7) / 8;
+    if (binary && bits_size < encoded_runs.size()) {
+        out.put(static_cast<char>(column_encoding::bits));
+        std::vector<char> bits(bits_size, 0);
+        for (std::size_t i = begin; i < data_end; i++) {
+            if (table_col[i] == one) {
+                bits[(i - begin) / 8] |= static_cast<char>(1 << ((i - begin) % 8));
+            }
+        }
+        out.write(bits.data(), static_cast<std::streamsize>(bits.size()));
+    } else {
+        out.put(static_cast<char>(column_encoding::runs));
+        out.write(encoded_runs.data(), static_cast<std::streamsize>(encoded_runs.size()));
+    }
+}
+
+/**
+ * @brief Write columns in the given format: plain section is prefixed with the number of cells,
+ * compact columns are encoded one by one.
+ */
+template<typename Endianness, typename ArithmetizationType, typename ColumnGetter>
+void write_columns_section(std::uint32_t columns_amount, std::size_t begin, std::size_t end,
+                           std::size_t padded_rows_amount, table_format format,
+                           const ColumnGetter& get_column, std::ostream& out) {
+    if (format == table_format::compact) {
+        for (std::uint32_t i = 0; i < columns_amount; i++) {
+            write_compact_column<Endianness, ArithmetizationType>(begin, end, padded_rows_amount,
+                                                                  get_column(i), out);
+        }
+        return;
     }
+    write_size_t<Endianness>(columns_amount * padded_rows_amount, out);
+    for (std::uint32_t i = 0; i < columns_amount; i++) {
+        write_vector_value<Endianness, ArithmetizationType>(begin, end, padded_rows_amount,
+                                                            get_column(i), out);
+    }
+}
+
+/**
+ * @brief Write header, witness and public input columns of rows [begin, end) of assignment
+ * table serialized into binary to output stream. These are the columns filled per block.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+void write_binary_block_columns(const TableType& table, std::size_t begin, std::size_t end,
+                                std::ostream& out,
+                                table_format format = table_format::plain) {
+    std::uint32_t public_input_size = table.public_inputs_amount();
+    std::uint32_t witness_size = table.witnesses_amount();
+    std::uint32_t constant_size = table.constants_amount();
+    std::uint32_t selector_size = table.selectors_amount();
 
-    using column_type = typename nil::crypto3::zk::snark::plonk_column<BlueprintFieldType>;
+    const std::size_t usable_rows_amount = end - begin;
+    const std::size_t padded_rows_amount = padded_rows(usable_rows_amount);
 
+    if (format == table_format::compact) {
+        out.write(reinterpret_cast<const char*>(kCompactTableMagic.data()),
+                  kCompactTableMagic.size());
+    }
     write_size_t<Endianness>(witness_size, out);
     write_size_t<Endianness>(public_input_size, out);
     write_size_t<Endianness>(constant_size, out);
@@ -134,50 +354,462 @@ void write_binary_assignment(const nil::blueprint::assignment<ArithmetizationTyp
     write_size_t<Endianness>(usable_rows_amount, out);
     write_size_t<Endianness>(padded_rows_amount, out);
 
-    write_size_t<Endianness>(witness_size * padded_rows_amount, out);
-    for (std::uint32_t i = 0; i < witness_size; i++) {
-        write_vector_value<Endianness, ArithmetizationType, column_type>(padded_rows_amount,
-                                                                         table.witness(i), out);
-    }
+    write_columns_section<Endianness, ArithmetizationType>(
+        witness_size, begin, end, padded_rows_amount, format,
+        [&](std::uint32_t i) -> decltype(auto) { return table.witness(i); }, out);
+    write_columns_section<Endianness, ArithmetizationType>(
+        public_input_size, begin, end, padded_rows_amount, format,
+        [&](std::uint32_t i) -> decltype(auto) { return table.public_input(i); }, out);
+}
+
+/**
+ * @brief Write constant and selector columns of rows [begin, end) of assignment table
+ * serialized into binary to output stream. These columns are set up by circuit preset and are
+ * the same for all blocks.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+void write_binary_static_columns(const TableType& table, std::size_t begin, std::size_t end,
+                                 std::ostream& out,
+                                 table_format format = table_format::plain) {
+    const std::size_t padded_rows_amount = padded_rows(end - begin);
+
+    write_columns_section<Endianness, ArithmetizationType>(
+        table.constants_amount(), begin, end, padded_rows_amount, format,
+        [&](std::uint32_t i) -> decltype(auto) { return table.constant(i); }, out);
+    write_columns_section<Endianness, ArithmetizationType>(
+        table.selectors_amount(), begin, end, padded_rows_amount, format,
+        [&](std::uint32_t i) -> decltype(auto) { return table.selector(i); }, out);
+}
+
+/**
+ * @brief Write rows [begin, end) of assignment table serialized into binary to output stream.
+ * Output has the same format as a whole table with `end - begin` usable rows.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+void write_binary_assignment(const TableType& table, std::size_t begin, std::size_t end,
+                             std::ostream& out,
+                             table_format format = table_format::plain) {
+    write_binary_block_columns<Endianness, ArithmetizationType, BlueprintFieldType>(
+        table, begin, end, out, format);
+    write_binary_static_columns<Endianness, ArithmetizationType, BlueprintFieldType>(
+        table, begin, end, out, format);
+}
 
-    write_size_t<Endianness>(public_input_size * padded_rows_amount, out);
-    for (std::uint32_t i = 0; i < public_input_size; i++) {
-        write_vector_value<Endianness, ArithmetizationType, column_type>(
-            padded_rows_amount, table.public_input(i), out);
+/**
+ * @brief Max size of constant and selector columns.
+ */
+template<typename TableType>
+std::size_t static_rows(const TableType& table) {
+    std::size_t result = 0;
+    for (std::uint32_t i = 0; i < table.constants_amount(); i++) {
+        result = std::max<std::size_t>(result, table.constant_column_size(i));
+    }
+    for (std::uint32_t i = 0; i < table.selectors_amount(); i++) {
+        result = std::max<std::size_t>(result, table.selector_column_size(i));
     }
+    return result;
+}
 
-    write_size_t<Endianness>(constant_size * padded_rows_amount, out);
-    for (std::uint32_t i = 0; i < constant_size; i++) {
-        write_vector_value<Endianness, ArithmetizationType, column_type>(padded_rows_amount,
-                                                                         table.constant(i), out);
+/// @brief Size of Keccak-256 hash of static columns stored in tables referencing them
+constexpr std::size_t kStaticColumnsDigestSize = 32;
+
+/**
+ * @brief Serialized static columns of a table, stored once in a file named by their hash.
+ *
+ * Content is a table without witness and public input columns holding rows [0, static_rows)
+ * of constant and selector columns, it is independent of rows filled by a block.
+ */
+struct static_columns {
+    core::mpt::NodeKey digest;
+    std::string content;
+
+    /// @brief Shared file `static_columns.<keccak256>` placed next to `table_filename`
+    std::string filename(const std::string& table_filename, compression_codec codec) const {
+        static constexpr char kDigits[] = "0123456789abcdef";
+        std::string hex;
+        for (const auto byte : digest.bytes()) {
+            hex.push_back(kDigits[std::to_integer<std::uint8_t>(byte) >> 4]);
+            hex.push_back(kDigits[std::to_integer<std::uint8_t>(byte) & 0xf]);
+        }
+        return (std::filesystem::path(table_filename).parent_path() /
+                ("static_columns." + hex + compression_suffix(codec)))
+            .string();
     }
+};
 
-    write_size_t<Endianness>(selector_size * padded_rows_amount, out);
-    for (std::uint32_t i = 0; i < selector_size; i++) {
-        write_vector_value<Endianness, ArithmetizationType, column_type>(padded_rows_amount,
-                                                                         table.selector(i), out);
+/**
+ * @brief Serialize static columns of assignment table and hash them.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+static_columns serialize_static_columns(const TableType& table,
+                                        table_format format = table_format::plain) {
+    const std::size_t rows = static_rows(table);
+    const std::size_t padded_rows_amount = padded_rows(rows);
+    std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+    if (format == table_format::compact) {
+        out.write(reinterpret_cast<const char*>(kCompactTableMagic.data()),
+                  kCompactTableMagic.size());
+    }
+    for (const std::size_t size : {std::size_t{0}, std::size_t{0},
+                                   std::size_t{table.constants_amount()},
+                                   std::size_t{table.selectors_amount()}, rows,
+                                   padded_rows_amount}) {
+        write_size_t<Endianness>(size, out);
+    }
+    // Empty witness and public input sections
+    if (format == table_format::plain) {
+        write_size_t<Endianness>(0, out);
+        write_size_t<Endianness>(0, out);
     }
+    write_binary_static_columns<Endianness, ArithmetizationType, BlueprintFieldType>(
+        table, 0, rows, out, format);
+    static_columns result;
+    result.content = std::move(out).str();
+    result.digest = core::mpt::Keccak256Hasher().Hash(std::as_bytes(std::span(result.content)));
+    return result;
 }
 
 /**
- * @brief Write assignment tables serialized into binary to output file.
+ * @brief Static columns serialized for previous blocks by circuit.
+ *
+ * Static columns are set up by circuit preset and are the same for every block, comparing them
+ * with the cached copy is much cheaper than serializing and hashing them again. Not thread safe.
  */
 template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType>
+class static_columns_cache {
+  public:
+    /// @brief Serialized static columns of the table, reused while they don't change
+    template<typename TableType>
+    const static_columns& get(std::size_t circuit, const TableType& table, table_format format) {
+        auto& cached = m_entries[circuit];
+        if (cached.shared && cached.format == format &&
+            same_columns(cached.constants, table.constants_amount(),
+                         [&](std::uint32_t i) -> decltype(auto) { return table.constant(i); }) &&
+            same_columns(cached.selectors, table.selectors_amount(),
+                         [&](std::uint32_t i) -> decltype(auto) { return table.selector(i); })) {
+            return *cached.shared;
+        }
+        cached.format = format;
+        copy_columns(cached.constants, table.constants_amount(),
+                     [&](std::uint32_t i) -> decltype(auto) { return table.constant(i); });
+        copy_columns(cached.selectors, table.selectors_amount(),
+                     [&](std::uint32_t i) -> decltype(auto) { return table.selector(i); });
+        cached.shared =
+            serialize_static_columns<Endianness, ArithmetizationType, BlueprintFieldType>(table,
+                                                                                          format);
+        return *cached.shared;
+    }
+
+  private:
+    using value_type = typename BlueprintFieldType::value_type;
+    using columns_type = std::vector<std::vector<value_type>>;
+
+    struct entry {
+        table_format format = table_format::plain;
+        columns_type constants;
+        columns_type selectors;
+        std::optional<static_columns> shared;
+    };
+
+    template<typename ColumnGetter>
+    static bool same_columns(const columns_type& cached, std::uint32_t amount,
+                             const ColumnGetter& get_column) {
+        if (cached.size() != amount) {
+            return false;
+        }
+        for (std::uint32_t i = 0; i < amount; i++) {
+            const auto& column = get_column(i);
+            if (column.size() != cached[i].size()) {
+                return false;
+            }
+            for (std::size_t row = 0; row < column.size(); row++) {
+                if (column[row] != cached[i][row]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<typename ColumnGetter>
+    static void copy_columns(columns_type& cached, std::uint32_t amount,
+                             const ColumnGetter& get_column) {
+        cached.assign(amount, {});
+        for (std::uint32_t i = 0; i < amount; i++) {
+            const auto& column = get_column(i);
+            cached[i].reserve(column.size());
+            for (std::size_t row = 0; row < column.size(); row++) {
+                cached[i].push_back(column[row]);
+            }
+        }
+    }
+
+    std::unordered_map<std::size_t, entry> m_entries;
+};
+
+/**
+ * @brief Write per block part of rows [begin, end) of assignment table referencing shared
+ * static columns: header, witness and public input columns followed by `begin` and the hash of
+ * static columns. The whole table is restored by `restore_shared_assignment`.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+void write_binary_assignment_shared(const TableType& table, std::size_t begin, std::size_t end,
+                                    const core::mpt::NodeKey& static_digest, std::ostream& out,
+                                    table_format format = table_format::plain) {
+    write_binary_block_columns<Endianness, ArithmetizationType, BlueprintFieldType>(
+        table, begin, end, out, format);
+    write_size_t<Endianness>(begin, out);
+    const auto digest = static_digest.bytes();
+    out.write(reinterpret_cast<const char*>(digest.data()),
+              static_cast<std::streamsize>(digest.size()));
+}
+
+/**
+ * @brief Write assignment table serialized into binary to output stream.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+void write_binary_assignment(const TableType& table, std::ostream& out) {
+    write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+        table, 0, usable_rows(table), out);
+}
+
+/**
+ * @brief Options of writing binary assignment tables.
+ */
+struct table_output_options {
+    /// @brief Max usable rows of one segment. If not set, every table is written into a single
+    /// file. Segments of `2^k - 1` rows are padded to `2^k`.
+    std::optional<std::size_t> segment_rows;
+
+    /// @brief Rows of the previous segment repeated at the beginning of the next one, so gates
+    /// with rotations can be checked on segment boundaries
+    std::size_t segment_overlap = 0;
+
+    /// @brief Write constant and selector columns once into a file shared by all blocks, see
+    /// `write_binary_assignment_shared`
+    bool shared_static_columns = false;
+
+    table_format format = table_format::plain;
+
+    /// @brief Compress table files in seekable chunked format, codec suffix is appended to
+    /// their names
+    compression_options compression;
+
+    /// @brief Write digest manifest `basefilename.N.digest.json` of every table, see
+    /// `compute_table_digest`
+    bool write_digest = false;
+};
+
+/**
+ * @brief File with rows [begin, end) of a table. Rows before `first_row` repeat the end of the
+ * previous segment.
+ */
+struct table_segment {
+    std::string filename;
+    std::size_t begin;
+    std::size_t first_row;
+    std::size_t end;
+};
+
+/**
+ * @brief Split table rows into segments written to `filename.segN`. Without segmentation the
+ * whole table is written to `filename`.
+ */
+inline std::vector<table_segment> plan_table_segments(std::size_t usable_rows_amount,
+                                                      const std::string& filename,
+                                                      const table_output_options& options) {
+    const auto suffix = compression_suffix(options.compression.codec);
+    if (!options.segment_rows) {
+        return {{filename + suffix, 0, 0, usable_rows_amount}};
+    }
+    const std::size_t step = std::max<std::size_t>(*options.segment_rows, 1);
+    const std::size_t overlap = std::min(options.segment_overlap, step - 1);
+    std::vector<table_segment> segments;
+    std::size_t first_row = 0;
+    do {
+        const std::size_t begin = first_row == 0 ? 0 : first_row - overlap;
+        const std::size_t end = std::min(usable_rows_amount, begin + step);
+        segments.push_back({filename + ".seg" + std::to_string(segments.size()) + suffix,
+                            begin, first_row, end});
+        first_row = end;
+    } while (first_row < usable_rows_amount);
+    return segments;
+}
+
+/**
+ * @brief Continuation metadata of a segmented table in JSON.
+ */
+inline std::string table_segments_metadata(std::size_t circuit, std::size_t usable_rows_amount,
+                                           const std::vector<table_segment>& segments,
+                                           const table_output_options& options) {
+    boost::json::array segments_json;
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        const auto& segment = segments[i];
+        // Paths are relative to the metadata file
+        const auto slash = segment.filename.find_last_of('/');
+        segments_json.push_back(boost::json::object{
+            {"index", i},
+            {"file", slash == std::string::npos ? segment.filename
+                                                : segment.filename.substr(slash + 1)},
+            {"begin", segment.begin},
+            {"first_row", segment.first_row},
+            {"end", segment.end},
+            {"usable_rows", segment.end - segment.begin},
+            {"padded_rows", padded_rows(segment.end - segment.begin)},
+        });
+    }
+    return boost::json::serialize(boost::json::object{
+        {"circuit", circuit},
+        {"usable_rows", usable_rows_amount},
+        {"segment_rows", options.segment_rows.value_or(usable_rows_amount)},
+        {"segment_overlap", options.segment_overlap},
+        {"segments", std::move(segments_json)},
+    });
+}
+
+/**
+ * @brief Write file via a temporary one renamed when it is complete, so readers never see a
+ * partially written file.
+ */
+inline std::optional<std::string> write_file_atomically(const std::string& filename,
+                                                        std::string_view content) {
+    const auto temp_filename = filename + ".tmp" + std::to_string(std::random_device{}());
+    std::ofstream fout(temp_filename, std::ios_base::binary | std::ios_base::out);
+    if (!fout.is_open()) {
+        return "Cannot open " + temp_filename;
+    }
+    fout.write(content.data(), static_cast<std::streamsize>(content.size()));
+    fout.close();
+    std::error_code ec;
+    if (!fout) {
+        std::filesystem::remove(temp_filename, ec);
+        return "Failed to write " + temp_filename;
+    }
+    std::filesystem::rename(temp_filename, filename, ec);
+    if (ec) {
+        std::filesystem::remove(temp_filename, ec);
+        return "Cannot rename " + temp_filename + " to " + filename + ": " + ec.message();
+    }
+    return {};
+}
+
+/**
+ * @brief Write shared static columns unless a file with the same content exists already.
+ */
+inline std::optional<std::string> write_static_columns(const static_columns& shared,
+                                                       const std::string& filename,
+                                                       const compression_options& compression) {
+    if (std::filesystem::exists(filename)) {
+        return {};
+    }
+    BOOST_LOG_TRIVIAL(debug) << "writing static columns into file " << filename;
+    if (compression.codec == compression_codec::none) {
+        return write_file_atomically(filename, shared.content);
+    }
+    return write_file_atomically(filename, compress_chunked(shared.content, compression));
+}
+
+/**
+ * @brief Write table serialized into binary to `filename`, its segments, digest manifest and
+ * segments metadata. If `static_digest` is set, the table references shared static columns,
+ * which are written by the caller.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
+std::optional<std::string> write_binary_table_files(std::size_t circuit, const TableType& table,
+                                                    const std::string& filename,
+                                                    const table_output_options& options,
+                                                    const core::mpt::NodeKey* static_digest) {
+    const auto rows = usable_rows(table);
+    const auto segments = plan_table_segments(rows, filename, options);
+    for (const auto& segment : segments) {
+        std::ofstream file(segment.filename, std::ios_base::binary | std::ios_base::out);
+        if (!file.is_open()) {
+            return "Cannot open " + segment.filename;
+        }
+        std::optional<chunked_compress_ostream> compressed;
+        if (options.compression.codec != compression_codec::none) {
+            compressed.emplace(file, options.compression);
+        }
+        std::ostream& fout = compressed ? *compressed : static_cast<std::ostream&>(file);
+        BOOST_LOG_TRIVIAL(debug) << "writing table " << circuit << " rows " << segment.begin
+                                 << "-" << segment.end << " into file " << segment.filename;
+        if (static_digest != nullptr) {
+            write_binary_assignment_shared<Endianness, ArithmetizationType, BlueprintFieldType>(
+                table, segment.begin, segment.end, *static_digest, fout, options.format);
+        } else {
+            write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+                table, segment.begin, segment.end, fout, options.format);
+        }
+        if (compressed) {
+            compressed->close();
+        }
+        file.close();
+        if (!file) {
+            return "Failed to write " + segment.filename;
+        }
+    }
+    if (options.write_digest) {
+        const auto manifest_filename = digest_manifest_name(filename);
+        std::ofstream fout(manifest_filename, std::ios_base::out);
+        if (!fout.is_open()) {
+            return "Cannot open " + manifest_filename;
+        }
+        fout << compute_table_digest<BlueprintFieldType>(table).to_json(circuit);
+    }
+    if (options.segment_rows) {
+        const std::string metadata_filename = filename + ".segments.json";
+        std::ofstream fout(metadata_filename, std::ios_base::out);
+        if (!fout.is_open()) {
+            return "Cannot open " + metadata_filename;
+        }
+        fout << table_segments_metadata(circuit, rows, segments, options);
+    }
+    return {};
+}
+
+/**
+ * @brief Write assignment tables serialized into binary to output file. With segmentation
+ * each table is split into segment files and `basefilename.N.segments.json` describes them.
+ * Tables are nil::blueprint::assignment or `spilled_table`.
+ */
+template<typename Endianness, typename ArithmetizationType, typename BlueprintFieldType,
+         typename TableType>
 std::optional<std::string> write_binary_assignments(
-    const std::unordered_map<nil::evm_assigner::zkevm_circuit,
-                             nil::blueprint::assignment<ArithmetizationType>>& assignments,
-    const std::string& basefilename) {
+    const std::unordered_map<nil::evm_assigner::zkevm_circuit, TableType>& assignments,
+    const std::string& basefilename, const table_output_options& options = {},
+    static_columns_cache<Endianness, ArithmetizationType, BlueprintFieldType>* cache = nullptr) {
     for (const auto& assignment : assignments) {
         std::string filename = basefilename + "." + std::to_string(assignment.first);
-        std::ofstream fout(filename, std::ios_base::binary | std::ios_base::out);
-        if (!fout.is_open()) {
-            return "Cannot open " + filename;
+        std::optional<static_columns> serialized;
+        const static_columns* shared = nullptr;
+        if (options.shared_static_columns) {
+            if (cache != nullptr) {
+                shared = &cache->get(assignment.first, assignment.second, options.format);
+            } else {
+                serialized =
+                    serialize_static_columns<Endianness, ArithmetizationType, BlueprintFieldType>(
+                        assignment.second, options.format);
+                shared = &*serialized;
+            }
+            auto err = write_static_columns(
+                *shared, shared->filename(filename, options.compression.codec),
+                options.compression);
+            if (err) {
+                return err;
+            }
+        }
+        auto err = write_binary_table_files<Endianness, ArithmetizationType, BlueprintFieldType>(
+            assignment.first, assignment.second, filename, options,
+            shared != nullptr ? &shared->digest : nullptr);
+        if (err) {
+            return err;
         }
-        BOOST_LOG_TRIVIAL(debug) << "writing table " << assignment.first << " into file "
-                                 << filename;
-        write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
-            assignment.second, fout);
-        fout.close();
     }
     return {};
 }
@@ -189,7 +821,7 @@ template<typename Endianness, typename ArithmetizationType, typename BlueprintFi
 std::optional<std::string> write_output_artifacts(
     const std::unordered_map<nil::evm_assigner::zkevm_circuit,
                              nil::blueprint::assignment<ArithmetizationType>>& assignments,
-    const OutputArtifacts& artifacts) {
+    const OutputArtifacts& artifacts, const compression_options& compression = {}) {
     BOOST_LOG_TRIVIAL(debug) << "\n";
     BOOST_LOG_TRIVIAL(debug) << "writing output artifacts to " << artifacts.basename;
     BOOST_LOG_TRIVIAL(debug) << "tables to print: " << artifacts.tables_to_string();
@@ -204,6 +836,9 @@ std::optional<std::string> write_output_artifacts(
                              << artifacts.selector_columns.to_string();
     BOOST_LOG_TRIVIAL(debug) << "\n";
 
+    if (artifacts.gzip && compression.codec != compression_codec::none) {
+        return "Readable output can't be both gzipped and compressed in chunks";
+    }
     if (assignments.empty()) {
         return {};
     }
@@ -215,7 +850,7 @@ std::optional<std::string> write_output_artifacts(
         if (it == assignments.end()) {
             return "Can't find assignment table " + std::to_string(i);
         }
-        auto assignment = it->second;
+        const auto& assignment = it->second;
 
         Ranges::ConcreteRanges witnesses = {};
         if (!artifacts.witness_columns.empty()) {
@@ -271,13 +906,21 @@ std::optional<std::string> write_output_artifacts(
             rows = maybe_rows.value();
         }
 
+        text_export_options export_options;
+        export_options.gzip = artifacts.gzip;
         if (artifacts.to_stdout()) {
             BOOST_LOG_TRIVIAL(debug) << "writing table " << i << " to stdout";
 
-            assignment.export_table(std::cout, witnesses, public_inputs, constants, selectors,
-                                    rows);
+            export_table_parallel(assignment, std::cout, witnesses, public_inputs, constants,
+                                  selectors, rows, export_options);
         } else {
+            const bool chunked = compression.codec != compression_codec::none;
             std::string filename = artifacts.basename + "." + std::to_string(i);
+            if (artifacts.gzip) {
+                filename += ".gz";
+            } else if (chunked) {
+                filename += compression_suffix(compression.codec);
+            }
             BOOST_LOG_TRIVIAL(debug) << "writing table " << i << " into file " << filename;
 
             std::ofstream fout(filename, std::ios_base::binary | std::ios_base::out);
@@ -285,7 +928,15 @@ std::optional<std::string> write_output_artifacts(
                 error << "Cannot open " << filename;
                 return error.str();
             }
-            assignment.export_table(fout, witnesses, public_inputs, constants, selectors, rows);
+            if (chunked) {
+                chunked_compress_ostream out(fout, compression);
+                export_table_parallel(assignment, out, witnesses, public_inputs, constants,
+                                      selectors, rows, export_options);
+                out.close();
+            } else {
+                export_table_parallel(assignment, fout, witnesses, public_inputs, constants,
+                                      selectors, rows, export_options);
+            }
             fout.close();
         }
         BOOST_LOG_TRIVIAL(debug) << "\n";
@@ -8,6 +8,7 @@
 #include <iostream>
 
 #include "block_schema.def"
+#include "zkevm_framework/core/types/views.hpp"
 #include "zkevm_framework/json_helpers/json_helpers.hpp"
 
 template<typename T>
@@ -54,7 +55,7 @@ static std::optional<std::string> handle_message(const boost::json::object &val,
     if (err) {
         return err;
     }
-    message.m_data.data() = data_bytes;
+    message.m_data.data() = std::move(data_bytes);
     return {};
 }
 
@@ -66,13 +67,14 @@ static std::optional<std::string> handle_block(const boost::json::object &val,
     block.m_gasPrice.m_value = std::stoull(val.at("gasPrice").as_string().c_str());
 
     const auto &json_input_msgs = val.at("messages").as_array();
+    messages.reserve(messages.size() + json_input_msgs.size());
     for (const auto &msg : json_input_msgs) {
         core::types::Message message;
         const boost::json::object &msg_json = msg.as_object();
         if (auto parse_err = handle_message(msg_json, message)) {
             return parse_err.value();
         }
-        messages.push_back(message);
+        messages.push_back(std::move(message));
     }
     return {};
 }
@@ -103,7 +105,7 @@ std::optional<std::string> load_block_with_messages(core::types::Block &block,
 }
 
 std::optional<std::string> load_raw_block_with_messages(core::types::Block &block,
-                                                        std::vector<core::types::Message> &messages,
+                                                        input_messages &messages,
                                                         std::istream &block_data) {
     auto block_json = json_helpers::parse_json(block_data);
     if (!block_json) {
@@ -113,29 +115,38 @@ std::optional<std::string> load_raw_block_with_messages(core::types::Block &bloc
         !block_json.value().at("result").as_object().contains("content")) {
         return "Block content not found in the JSON";
     }
+    const auto &result = block_json.value().at("result").as_object();
     std::vector<std::byte> block_bytes;
-    std::string block_data_str = block_json.value().at("result").at("content").as_string().c_str();
-    auto deserialize_err = json_helpers::to_std_bytes(block_data_str, block_bytes);
+    auto deserialize_err =
+        json_helpers::append_std_bytes(result.at("content").as_string(), block_bytes);
     if (deserialize_err) {
         return "Extract block bytes failed: " + deserialize_err.value();
     }
-    block = ssz::deserialize<core::types::Block>(block_bytes);
+    const auto block_view = core::types::BlockView::parse(block_bytes);
+    if (!block_view) {
+        return "Block content is malformed";
+    }
+    block = block_view->to_block();
 
-    if (!block_json.value().as_object().contains("result") ||
-        !block_json.value().at("result").as_object().contains("inMessages")) {
+    if (!result.contains("inMessages")) {
         return "Input messages not found in the JSON";
     }
-    const auto &json_input_msgs = block_json.value().at("result").at("inMessages").as_array();
+    // All messages are decoded into one buffer and read through views
+    const auto &json_input_msgs = result.at("inMessages").as_array();
+    std::size_t total_size = 0;
     for (const auto &msg : json_input_msgs) {
-        core::types::Message message;
-        std::string msg_str = msg.as_string().c_str();
-        std::vector<std::byte> msg_bytes;
-        deserialize_err = json_helpers::to_std_bytes(msg_str, msg_bytes);
+        total_size += msg.as_string().size() / 2;
+    }
+    std::vector<std::byte> msg_bytes;
+    msg_bytes.reserve(total_size);
+    std::vector<std::size_t> msg_ends;
+    msg_ends.reserve(json_input_msgs.size());
+    for (const auto &msg : json_input_msgs) {
+        deserialize_err = json_helpers::append_std_bytes(msg.as_string(), msg_bytes);
         if (deserialize_err) {
             return "Extract message bytes failed: " + deserialize_err.value();
         }
-        message = ssz::deserialize<core::types::Message>(msg_bytes);
-        messages.push_back(message);
+        msg_ends.push_back(msg_bytes.size());
     }
-    return {};
+    return messages.assign_serialized(std::move(msg_bytes), msg_ends);
 }
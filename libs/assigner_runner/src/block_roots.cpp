@@ -0,0 +1,134 @@
+#include "zkevm_framework/assigner_runner/block_roots.hpp"
+
+#include <algorithm>
+#include <boost/algorithm/hex.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ssz++.hpp>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "zkevm_framework/core/hash_tree_root.hpp"
+#include "zkevm_framework/core/mpt/hasher.hpp"
+#include "zkevm_framework/core/mpt/mpt.hpp"
+#include "zkevm_framework/core/parallel_for.hpp"
+
+namespace {
+    std::string to_hex(const core::Hash& hash) {
+        std::string hex = "0x";
+        const auto* data = reinterpret_cast<const char*>(hash.data());
+        boost::algorithm::hex_lower(data, data + hash.size(), std::back_inserter(hex));
+        return hex;
+    }
+
+    std::optional<core::Hash> from_hex(const boost::json::value& value) {
+        if (!value.is_string()) {
+            return std::nullopt;
+        }
+        std::string_view hex = value.as_string();
+        if (hex.starts_with("0x")) {
+            hex.remove_prefix(2);
+        }
+        core::Hash result;
+        if (hex.size() != 2 * result.size()) {
+            return std::nullopt;
+        }
+        std::string bytes;
+        try {
+            boost::algorithm::unhex(hex.begin(), hex.end(), std::back_inserter(bytes));
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+        std::transform(bytes.begin(), bytes.end(), result.begin(),
+                       [](char c) { return static_cast<std::byte>(c); });
+        return result;
+    }
+}  // namespace
+
+block_roots compute_block_roots(const core::types::Block& block, const input_messages& messages,
+                                std::size_t threads) {
+    // Messages may be parsed or serialized, so their roots are computed here and the list is
+    // merkleized by the engine
+    std::vector<core::Hash> roots(messages.size());
+    core::parallel_for(messages.size(), threads, [&](std::size_t i) {
+        messages.visit_at(i,
+                          [&](const auto& message) { roots[i] = core::hash_tree_root(message); });
+    });
+    return {.block = core::hash_tree_root(block),
+            .in_messages = core::list_root(roots, threads)};
+}
+
+core::Hash in_messages_trie_root(const input_messages& messages, std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    core::Hash result{};
+    if (messages.empty()) {
+        return result;
+    }
+
+    // Parsed messages have to be serialized, so values are prepared in parallel as well
+    using entry = std::pair<std::vector<std::byte>, std::vector<std::byte>>;
+    std::vector<entry> entries(messages.size());
+    core::parallel_for(messages.size(), threads, [&](std::size_t i) {
+        auto& [key, value] = entries[i];
+        key = ssz::serialize(static_cast<std::uint64_t>(i));
+        messages.visit_at(i, [&value](const auto& message) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(message)>,
+                                         core::types::MessageView>) {
+                value.assign(message.bytes().begin(), message.bytes().end());
+            } else {
+                value = ssz::serialize(message);
+            }
+        });
+    });
+
+    core::mpt::MerklePatriciaTrie trie(
+        std::make_shared<core::mpt::ParallelHasher>(core::mpt::DefaultHasher(), threads));
+    trie.build(std::move(entries));
+    const auto& root = trie.root();
+    std::copy_n(root.begin(), std::min(root.size(), result.size()), result.begin());
+    return result;
+}
+
+std::string block_roots_to_json(const std::vector<block_roots>& roots) {
+    boost::json::array blocks;
+    for (const auto& block : roots) {
+        blocks.push_back(boost::json::object{
+            {"block", to_hex(block.block)},
+            {"in_messages", to_hex(block.in_messages)},
+        });
+    }
+    return boost::json::serialize(boost::json::object{{"blocks", std::move(blocks)}});
+}
+
+std::optional<std::string> block_roots_from_json(const std::string& json,
+                                                 std::vector<block_roots>& result) {
+    boost::json::error_code ec;
+    const auto value = boost::json::parse(json, ec);
+    if (ec || !value.is_object() || !value.as_object().contains("blocks") ||
+        !value.at("blocks").is_array()) {
+        return "Block roots manifest must be a JSON object with array of blocks";
+    }
+    result.clear();
+    for (const auto& block_value : value.at("blocks").as_array()) {
+        const auto* block_object = block_value.if_object();
+        if (!block_object || !block_object->contains("block") ||
+            !block_object->contains("in_messages")) {
+            return "Invalid block " + std::to_string(result.size()) + " in block roots manifest";
+        }
+        const auto block = from_hex(block_object->at("block"));
+        const auto in_messages = from_hex(block_object->at("in_messages"));
+        if (!block || !in_messages) {
+            return "Invalid roots of block " + std::to_string(result.size());
+        }
+        result.push_back({.block = *block, .in_messages = *in_messages});
+    }
+    return {};
+}
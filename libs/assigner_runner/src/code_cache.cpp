@@ -0,0 +1,18 @@
+#include "zkevm_framework/assigner_runner/code_cache.hpp"
+
+code_cache::code_ptr code_cache::get(std::span<const uint8_t> code) {
+    const auto code_hash = m_hasher.Hash(std::as_bytes(code));
+    if (const auto* cached = m_entries.find(code_hash)) {
+        ++m_hits;
+        return *cached;
+    }
+    ++m_misses;
+    auto entry = std::make_shared<const cached_code>(code, code_hash);
+    m_entries.insert_or_assign(code_hash, entry);
+    return entry;
+}
+
+code_cache::code_ptr code_cache::find(const core::mpt::NodeKey& code_hash) const {
+    const auto* cached = m_entries.find(code_hash);
+    return cached != nullptr ? *cached : nullptr;
+}
@@ -0,0 +1,370 @@
+#include "zkevm_framework/assigner_runner/compression.hpp"
+
+#include <algorithm>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    constexpr std::uint32_t kSkippableFrameMagic = 0x184D2A5E;
+    constexpr char kIndexMagic[4] = {'z', 'k', 'c', 'z'};
+    // Skippable frame header and index trailer: chunks amount, codec and magic
+    constexpr std::size_t kFrameHeaderSize = 8;
+    constexpr std::size_t kTrailerSize = 16;
+    constexpr std::size_t kIndexEntrySize = 16;
+
+    void put_le(std::string& out, std::uint64_t value, std::size_t bytes) {
+        for (std::size_t i = 0; i < bytes; i++) {
+            out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+        }
+    }
+
+    std::uint64_t get_le(const char* data, std::size_t bytes) {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < bytes; i++) {
+            value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i])) << (8 * i);
+        }
+        return value;
+    }
+
+    std::string encode_index(const std::vector<std::pair<std::uint64_t, std::uint64_t>>& index,
+                             compression_codec codec) {
+        std::string out;
+        const std::size_t content_size = index.size() * kIndexEntrySize + kTrailerSize;
+        put_le(out, kSkippableFrameMagic, 4);
+        put_le(out, content_size, 4);
+        for (const auto& [compressed, uncompressed] : index) {
+            put_le(out, compressed, 8);
+            put_le(out, uncompressed, 8);
+        }
+        put_le(out, index.size(), 8);
+        put_le(out, static_cast<std::uint32_t>(codec), 4);
+        out.append(kIndexMagic, sizeof(kIndexMagic));
+        return out;
+    }
+
+    std::size_t threads_amount(const compression_options& options) {
+        return options.threads != 0 ? options.threads
+                                    : std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    }
+}  // namespace
+
+std::expected<compression_options, std::string> compression_options::parse(
+    const std::string& spec) {
+    compression_options options;
+    const auto colon = spec.find(':');
+    const auto codec = spec.substr(0, colon);
+    if (codec == "none") {
+        options.codec = compression_codec::none;
+    } else if (codec == "gzip") {
+        options.codec = compression_codec::gzip;
+    } else if (codec == "zstd") {
+        options.codec = compression_codec::zstd;
+    } else {
+        return std::unexpected("Unknown compression codec: " + codec);
+    }
+    if (colon != std::string::npos) {
+        const auto level = spec.substr(colon + 1);
+        try {
+            std::size_t parsed = 0;
+            options.level = std::stoi(level, &parsed);
+            if (parsed != level.size()) {
+                throw std::invalid_argument(level);
+            }
+        } catch (const std::exception&) {
+            return std::unexpected("Invalid compression level: " + level);
+        }
+        const int max_level = options.codec == compression_codec::zstd ? 22 : 9;
+        if (options.codec == compression_codec::none || options.level < 1 ||
+            options.level > max_level) {
+            return std::unexpected("Compression level of " + codec + " must be in [1, " +
+                                   std::to_string(max_level) + "]");
+        }
+    }
+    return options;
+}
+
+std::string compression_suffix(compression_codec codec) {
+    switch (codec) {
+        case compression_codec::gzip:
+            return ".gz";
+        case compression_codec::zstd:
+            return ".zst";
+        case compression_codec::none:
+            break;
+    }
+    return "";
+}
+
+std::string compress_frame(std::string_view data, compression_codec codec, int level) {
+    namespace io = boost::iostreams;
+    if (codec == compression_codec::none) {
+        return std::string(data);
+    }
+    std::string compressed;
+    {
+        io::filtering_ostream out;
+        if (codec == compression_codec::zstd) {
+            out.push(io::zstd_compressor(
+                io::zstd_params(level != 0 ? level : io::zstd::default_compression)));
+        } else {
+            out.push(io::gzip_compressor(
+                io::gzip_params(level != 0 ? level : io::gzip::default_compression)));
+        }
+        out.push(io::back_inserter(compressed));
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    return compressed;
+}
+
+std::optional<std::string> decompress_frame(std::string_view frame, compression_codec codec,
+                                            std::string& out) {
+    namespace io = boost::iostreams;
+    out.clear();
+    if (codec == compression_codec::none) {
+        out.assign(frame);
+        return {};
+    }
+    try {
+        io::filtering_istream in;
+        if (codec == compression_codec::zstd) {
+            in.push(io::zstd_decompressor());
+        } else {
+            in.push(io::gzip_decompressor());
+        }
+        in.push(io::array_source(frame.data(), frame.size()));
+        io::copy(in, io::back_inserter(out));
+    } catch (const std::exception& e) {
+        return std::string("Cannot decompress frame: ") + e.what();
+    }
+    return {};
+}
+
+std::string compress_chunked(std::string_view data, const compression_options& options) {
+    std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+    {
+        chunked_compress_ostream compressed(out, options);
+        compressed.write(data.data(), static_cast<std::streamsize>(data.size()));
+        compressed.close();
+    }
+    return std::move(out).str();
+}
+
+chunked_compress_buf::chunked_compress_buf(std::ostream& out, const compression_options& options)
+    : m_out(out),
+      m_options(options),
+      m_threads(threads_amount(options)),
+      m_window(m_threads * 2),
+      // Pending chunks never exceed the window, so pushing a job never blocks
+      m_jobs(m_window, std::numeric_limits<std::size_t>::max()) {
+    m_options.chunk_size = std::max<std::size_t>(m_options.chunk_size, 1);
+    m_chunk.reserve(m_options.chunk_size);
+}
+
+chunked_compress_buf::~chunked_compress_buf() {
+    try {
+        close();
+    } catch (...) {
+        // Destructor must not throw, output is incomplete anyway
+    }
+    m_jobs.finish();
+}
+
+void chunked_compress_buf::close() {
+    if (m_closed) {
+        return;
+    }
+    m_closed = true;
+    if (!m_chunk.empty()) {
+        submit_chunk();
+    }
+    write_frames(0);
+    const auto index = encode_index(m_index, m_options.codec);
+    m_out.write(index.data(), static_cast<std::streamsize>(index.size()));
+    m_out.flush();
+}
+
+chunked_compress_buf::int_type chunked_compress_buf::overflow(int_type ch) {
+    if (m_closed) {
+        return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        m_chunk.push_back(traits_type::to_char_type(ch));
+        if (m_chunk.size() >= m_options.chunk_size) {
+            submit_chunk();
+        }
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize chunked_compress_buf::xsputn(const char* s, std::streamsize n) {
+    if (m_closed) {
+        return 0;
+    }
+    std::size_t left = static_cast<std::size_t>(n);
+    while (left > 0) {
+        const auto part = std::min(left, m_options.chunk_size - m_chunk.size());
+        m_chunk.append(s, part);
+        s += part;
+        left -= part;
+        if (m_chunk.size() >= m_options.chunk_size) {
+            submit_chunk();
+        }
+    }
+    return n;
+}
+
+void chunked_compress_buf::submit_chunk() {
+    write_frames(m_window - 1);
+    // Workers are started as chunks queue up, a small file is compressed by one worker
+    if (m_workers.size() < m_threads && m_workers.size() <= m_pending.size()) {
+        m_workers.emplace_back([this] { compress_chunks(); });
+    }
+    compress_job job{std::move(m_chunk), {}};
+    m_pending.emplace_back(job.chunk.size(), job.frame.get_future());
+    m_jobs.push(std::move(job));
+    m_chunk = std::string();
+    m_chunk.reserve(m_options.chunk_size);
+}
+
+void chunked_compress_buf::compress_chunks() {
+    while (auto job = m_jobs.pop()) {
+        try {
+            job->frame.set_value(compress_frame(job->chunk, m_options.codec, m_options.level));
+        } catch (...) {
+            job->frame.set_exception(std::current_exception());
+        }
+    }
+}
+
+void chunked_compress_buf::write_frames(std::size_t max_pending) {
+    // Frames are written in order, so only the oldest ones are waited for
+    while (m_pending.size() > max_pending) {
+        auto [size, frame_future] = std::move(m_pending.front());
+        m_pending.pop_front();
+        const auto frame = frame_future.get();
+        m_out.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+        m_index.emplace_back(frame.size(), size);
+    }
+}
+
+std::optional<std::string> chunked_decompressor::open(std::istream& in) {
+    m_in = &in;
+    m_chunks.clear();
+    m_size = 0;
+
+    in.seekg(0, std::ios_base::end);
+    const auto file_size = static_cast<std::uint64_t>(in.tellg());
+    if (!in || file_size < kFrameHeaderSize + kTrailerSize) {
+        return "Compressed file is too short";
+    }
+    char trailer[kTrailerSize];
+    in.seekg(static_cast<std::streamoff>(file_size - kTrailerSize));
+    in.read(trailer, kTrailerSize);
+    if (!in || std::memcmp(trailer + 12, kIndexMagic, sizeof(kIndexMagic)) != 0) {
+        return "Compressed file has no index";
+    }
+    const auto chunks = get_le(trailer, 8);
+    m_codec = static_cast<compression_codec>(get_le(trailer + 8, 4));
+    if (m_codec != compression_codec::none && m_codec != compression_codec::gzip &&
+        m_codec != compression_codec::zstd) {
+        return "Unknown compression codec";
+    }
+    if (chunks > (file_size - kFrameHeaderSize - kTrailerSize) / kIndexEntrySize) {
+        return "Invalid index of compressed file";
+    }
+
+    const std::uint64_t index_size = chunks * kIndexEntrySize;
+    const std::uint64_t frames_size = file_size - kFrameHeaderSize - index_size - kTrailerSize;
+    std::string index(kFrameHeaderSize + index_size, '\0');
+    in.seekg(static_cast<std::streamoff>(frames_size));
+    in.read(index.data(), static_cast<std::streamsize>(index.size()));
+    if (!in || get_le(index.data(), 4) != kSkippableFrameMagic ||
+        get_le(index.data() + 4, 4) != index_size + kTrailerSize) {
+        return "Invalid index of compressed file";
+    }
+
+    std::uint64_t offset = 0;
+    for (std::uint64_t i = 0; i < chunks; i++) {
+        const char* entry = index.data() + kFrameHeaderSize + i * kIndexEntrySize;
+        chunk c{offset, get_le(entry, 8), m_size, get_le(entry + 8, 8)};
+        if (c.compressed_size > frames_size - offset) {
+            return "Invalid index of compressed file";
+        }
+        offset += c.compressed_size;
+        m_size += c.uncompressed_size;
+        m_chunks.push_back(c);
+    }
+    if (offset != frames_size) {
+        return "Invalid index of compressed file";
+    }
+    return {};
+}
+
+std::optional<std::string> chunked_decompressor::read_chunk(std::size_t index,
+                                                            std::string& out) const {
+    const auto& c = m_chunks.at(index);
+    std::string frame(c.compressed_size, '\0');
+    m_in->clear();
+    m_in->seekg(static_cast<std::streamoff>(c.offset));
+    m_in->read(frame.data(), static_cast<std::streamsize>(frame.size()));
+    if (!*m_in) {
+        return "Cannot read frame " + std::to_string(index);
+    }
+    auto err = decompress_frame(frame, m_codec, out);
+    if (err) {
+        return err;
+    }
+    if (out.size() != c.uncompressed_size) {
+        return "Frame " + std::to_string(index) + " has unexpected size";
+    }
+    return {};
+}
+
+std::optional<std::string> chunked_decompressor::read(std::size_t offset, std::size_t length,
+                                                      std::string& out) const {
+    out.clear();
+    if (offset > m_size || length > m_size - offset) {
+        return "Read is out of compressed data";
+    }
+    if (length == 0) {
+        return {};
+    }
+    auto it = std::upper_bound(m_chunks.begin(), m_chunks.end(), offset,
+                               [](std::size_t value, const chunk& c) {
+                                   return value < c.uncompressed_offset;
+                               });
+    std::string data;
+    for (--it; out.size() < length; ++it) {
+        auto err = read_chunk(it - m_chunks.begin(), data);
+        if (err) {
+            return err;
+        }
+        const std::size_t begin = offset + out.size() - it->uncompressed_offset;
+        out.append(data, begin, std::min(data.size() - begin, length - out.size()));
+    }
+    return {};
+}
+
+chunked_decompress_buf::int_type chunked_decompress_buf::underflow() {
+    while (gptr() == egptr()) {
+        if (m_error || m_next_chunk >= m_reader.chunks_amount()) {
+            return traits_type::eof();
+        }
+        m_error = m_reader.read_chunk(m_next_chunk++, m_chunk);
+        if (m_error) {
+            m_chunk.clear();
+        }
+        setg(m_chunk.data(), m_chunk.data(), m_chunk.data() + m_chunk.size());
+    }
+    return traits_type::to_int_type(*gptr());
+}
@@ -0,0 +1,137 @@
+#include "zkevm_framework/assigner_runner/lazy_storage.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <utility>
+
+#include "zkevm_framework/assigner_runner/utils.hpp"
+
+namespace {
+    // Storage tries are keyed by raw 32-byte slot keys and keep raw 32-byte values
+    std::vector<std::byte> to_trie_bytes(const evmc::bytes32& v) {
+        const auto* data = reinterpret_cast<const std::byte*>(v.bytes);
+        return std::vector<std::byte>(data, data + sizeof(v.bytes));
+    }
+
+    evmc::bytes32 from_trie_bytes(const std::vector<std::byte>& v) {
+        evmc::bytes32 result{};
+        // Shorter values are right-aligned as big-endian numbers
+        const auto size = std::min(v.size(), sizeof(result.bytes));
+        std::memcpy(result.bytes + sizeof(result.bytes) - size, v.data() + v.size() - size, size);
+        return result;
+    }
+}  // namespace
+
+lazy_storage::lazy_storage(slot_loader load_slot, core::mpt::NodeLoader load_node)
+    : m_load_slot(std::move(load_slot)), m_load_node(std::move(load_node)) {}
+
+void lazy_storage::open_contract(const evmc::address& addr, const core::Hash& storage_root) {
+    core::mpt::Reference root;
+    if (std::any_of(storage_root.begin(), storage_root.end(),
+                    [](std::byte b) { return b != std::byte{0}; })) {
+        root.assign(storage_root.begin(), storage_root.end());
+    }
+    contract_storage storage;
+    if (m_load_node) {
+        storage.trie = core::mpt::MerklePatriciaTrie(std::move(root), m_load_node);
+    }
+    m_contracts.insert_or_assign(addr, std::move(storage));
+}
+
+bool lazy_storage::has_contract(const evmc::address& addr) const {
+    return m_contracts.contains(addr);
+}
+
+bool lazy_storage::is_loaded(const evmc::address& addr, const evmc::bytes32& key) const {
+    const auto it = m_contracts.find(addr);
+    return it != m_contracts.end() && it->second.slots.contains(key);
+}
+
+std::optional<std::string> lazy_storage::get(const evmc::address& addr, const evmc::bytes32& key,
+                                             evmc::bytes32& value) {
+    const auto contract_it = m_contracts.find(addr);
+    if (contract_it == m_contracts.end()) {
+        return "Storage of the contract is not opened: " + to_str(addr);
+    }
+    auto& storage = contract_it->second;
+    if (const auto it = storage.slots.find(key); it != storage.slots.end()) {
+        value = it->second;
+        return {};
+    }
+
+    try {
+        if (m_load_node) {
+            const auto stored = storage.trie.find(to_trie_bytes(key));
+            value = stored ? from_trie_bytes(*stored) : evmc::bytes32{};
+        } else {
+            if (auto err = m_load_slot(addr, key, value)) {
+                return "Failed loading storage slot " + to_str(key) + ": " + err.value();
+            }
+            // Keep the slot in the trie, so the root covers all touched slots
+            if (value != evmc::bytes32{}) {
+                storage.trie.set(to_trie_bytes(key), to_trie_bytes(value));
+            }
+        }
+    } catch (const std::exception& e) {
+        return "Storage trie of " + to_str(addr) + " is inconsistent: " + e.what();
+    }
+    storage.slots.emplace(key, value);
+    return {};
+}
+
+std::optional<std::string> lazy_storage::set(const evmc::address& addr, const evmc::bytes32& key,
+                                             const evmc::bytes32& value) {
+    evmc::bytes32 current;
+    if (auto err = get(addr, key, current)) {
+        return err;
+    }
+    if (current == value) {
+        return {};
+    }
+
+    auto& storage = m_contracts.at(addr);
+    try {
+        if (value == evmc::bytes32{}) {
+            storage.trie.remove(to_trie_bytes(key));
+        } else {
+            storage.trie.set(to_trie_bytes(key), to_trie_bytes(value));
+        }
+    } catch (const std::exception& e) {
+        return "Failed updating storage trie of " + to_str(addr) + ": " + e.what();
+    }
+    storage.slots[key] = value;
+    return {};
+}
+
+core::Hash lazy_storage::storage_root(const evmc::address& addr) const {
+    core::Hash result{};
+    const auto it = m_contracts.find(addr);
+    if (it == m_contracts.end() || it->second.trie.root().empty()) {
+        return result;
+    }
+    const auto& trie = it->second.trie;
+    // Root node is referenced by hash even if its encoding is short
+    const auto digest = trie.root().size() < 32
+                            ? trie.hasher().Hash(trie.root()).to_vector()
+                            : trie.root();
+    std::copy_n(digest.begin(), std::min(digest.size(), result.size()), result.begin());
+    return result;
+}
+
+std::vector<evmc::address> lazy_storage::contracts() const {
+    std::vector<evmc::address> result;
+    result.reserve(m_contracts.size());
+    for (const auto& [addr, storage] : m_contracts) {
+        result.push_back(addr);
+    }
+    return result;
+}
+
+std::size_t lazy_storage::loaded_slots() const {
+    std::size_t result = 0;
+    for (const auto& [addr, storage] : m_contracts) {
+        result += storage.slots.size();
+    }
+    return result;
+}
@@ -0,0 +1,112 @@
+#include "zkevm_framework/assigner_runner/mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::string errno_message(const std::string& action) {
+        return action + ": " + std::strerror(errno);
+    }
+}  // namespace
+
+mapped_file::mapped_file(mapped_file&& other) noexcept
+    : m_fd(std::exchange(other.m_fd, -1)),
+      m_size(std::exchange(other.m_size, 0)),
+      m_data(std::exchange(other.m_data, nullptr)) {}
+
+mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+    if (this != &other) {
+        reset();
+        m_fd = std::exchange(other.m_fd, -1);
+        m_size = std::exchange(other.m_size, 0);
+        m_data = std::exchange(other.m_data, nullptr);
+    }
+    return *this;
+}
+
+mapped_file::~mapped_file() { reset(); }
+
+void mapped_file::reset() {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+        m_data = nullptr;
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+}
+
+std::optional<std::string> mapped_file::create(const std::string& directory) {
+    reset();
+    std::string path_template = (directory.empty() ? "." : directory) + "/zkevm_spill_XXXXXX";
+    std::vector<char> path(path_template.begin(), path_template.end());
+    path.push_back('\0');
+    m_fd = ::mkstemp(path.data());
+    if (m_fd < 0) {
+        return errno_message("Cannot create spill file in " + directory);
+    }
+    ::unlink(path.data());
+    return {};
+}
+
+std::optional<std::string> mapped_file::append(std::span<const std::uint8_t> data) {
+    if (m_fd < 0 || m_data != nullptr) {
+        return "Spill file is not open for writing";
+    }
+    const std::uint8_t* pos = data.data();
+    std::size_t left = data.size();
+    while (left > 0) {
+        const auto written = ::write(m_fd, pos, left);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno_message("Cannot write spill file");
+        }
+        pos += written;
+        left -= static_cast<std::size_t>(written);
+    }
+    m_size += data.size();
+    return {};
+}
+
+std::optional<std::string> mapped_file::map() {
+    if (m_fd < 0) {
+        return "Spill file is not open";
+    }
+    if (m_size == 0) {
+        return {};
+    }
+    void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (data == MAP_FAILED) {
+        return errno_message("Cannot map file");
+    }
+    // Columns are read sequentially by writers
+    ::madvise(data, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const std::uint8_t*>(data);
+    return {};
+}
+
+std::optional<std::string> mapped_file::open(const std::string& filename) {
+    reset();
+    m_fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        return errno_message("Cannot open " + filename);
+    }
+    struct stat info;
+    if (::fstat(m_fd, &info) != 0) {
+        return errno_message("Cannot stat " + filename);
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    return map();
+}
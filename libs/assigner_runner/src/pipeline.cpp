@@ -0,0 +1,372 @@
+#include "zkevm_framework/assigner_runner/pipeline.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+#include "zkevm_framework/assigner_runner/bounded_queue.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+
+namespace {
+    struct loaded_block {
+        std::size_t index;
+        core::types::Block block;
+        input_messages messages;
+        block_origin origin;
+    };
+
+    template<typename AssignmentsType, typename SpilledAssignmentsType>
+    struct executed_block {
+        std::size_t index;
+        AssignmentsType assignments;
+        // Tables moved out of memory, assignments are empty then
+        SpilledAssignmentsType spilled;
+        bool is_spilled = false;
+    };
+
+    struct output_file {
+        std::string name;
+        std::string content;
+        // Shared static columns, the file may be written by another process as well
+        bool shared = false;
+    };
+
+    template<typename SpilledAssignmentsType>
+    struct serialized_block {
+        std::size_t index;
+        std::vector<output_file> files;
+        // Spilled tables are streamed into output files by the write stage
+        SpilledAssignmentsType spilled;
+        std::unordered_map<std::size_t, core::mpt::NodeKey> static_digests;
+    };
+
+    // Keeps the first error reported by any stage and aborts the others
+    class pipeline_error {
+      public:
+        template<typename... Queues>
+        void fail(std::string err, Queues&... queues) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error) {
+                    m_error = std::move(err);
+                }
+            }
+            (queues.close(), ...);
+        }
+
+        std::optional<std::string> get() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_error;
+        }
+
+      private:
+        mutable std::mutex m_mutex;
+        std::optional<std::string> m_error;
+    };
+
+    profiler::scoped_timer stage_scope(profiler* prof, std::string name) {
+        if (prof == nullptr) {
+            return {};
+        }
+        return prof->scope(std::move(name), "pipeline");
+    }
+}  // namespace
+
+template<typename BlueprintFieldType>
+std::string block_pipeline<BlueprintFieldType>::block_file_name(const std::string& basefilename,
+                                                                std::size_t index) {
+    return basefilename + ".block" + std::to_string(index);
+}
+
+template<typename BlueprintFieldType>
+std::size_t block_pipeline<BlueprintFieldType>::estimate_bytes(
+    const assignments_type& assignments) {
+    using value_type = typename BlueprintFieldType::value_type;
+    std::size_t cells = 0;
+    for (const auto& [_, table] : assignments) {
+        for (std::uint32_t i = 0; i < table.witnesses_amount(); i++) {
+            cells += table.witness_column_size(i);
+        }
+        for (std::uint32_t i = 0; i < table.public_inputs_amount(); i++) {
+            cells += table.public_input_column_size(i);
+        }
+        for (std::uint32_t i = 0; i < table.constants_amount(); i++) {
+            cells += table.constant_column_size(i);
+        }
+        for (std::uint32_t i = 0; i < table.selectors_amount(); i++) {
+            cells += table.selector_column_size(i);
+        }
+    }
+    return cells * sizeof(value_type);
+}
+
+template<typename BlueprintFieldType>
+std::optional<std::string> block_pipeline<BlueprintFieldType>::run(
+    const std::vector<block_source>& blocks, const std::string& assignment_table_file_name,
+    const std::optional<OutputArtifacts>& artifacts) {
+    using ArithmetizationType =
+        typename single_thread_runner<BlueprintFieldType>::ArithmetizationType;
+    using Endianness = nil::marshalling::option::big_endian;
+
+    const std::size_t depth = std::max<std::size_t>(m_options.queue_depth, 1);
+    // Parsed blocks are small comparing to tables, limit them by count only
+    bounded_queue<loaded_block> loaded(depth, std::numeric_limits<std::size_t>::max());
+    using executed_type = executed_block<assignments_type, spilled_assignments_type>;
+    bounded_queue<executed_type> executed(depth, m_options.memory_budget / 2);
+    using serialized_type = serialized_block<spilled_assignments_type>;
+    bounded_queue<serialized_type> serialized(depth, m_options.memory_budget / 2);
+    pipeline_error error;
+    profiler* prof = m_runner.get_profiler();
+
+    auto check_tables = [&](std::size_t index, const assignments_type& assignments) {
+        if (!m_table_check) {
+            return true;
+        }
+        auto timer = stage_scope(prof, "check block " + std::to_string(index));
+        auto err = m_table_check(index, assignments);
+        if (err) {
+            error.fail("Block " + std::to_string(index) + ": " + err.value(), loaded, executed,
+                       serialized);
+            return false;
+        }
+        return true;
+    };
+
+    std::thread fetch_stage([&] {
+        for (std::size_t i = 0; i < blocks.size(); ++i) {
+            auto timer = stage_scope(prof, "fetch block " + std::to_string(i));
+            loaded_block item{.index = i};
+            auto err = m_runner.load_block(blocks[i].hash, blocks[i].file_name, item.block,
+                                           item.messages, item.origin);
+            if (err) {
+                error.fail("Block " + std::to_string(i) + ": " + err.value(), loaded, executed,
+                           serialized);
+                return;
+            }
+            if (!loaded.push(std::move(item))) {
+                return;
+            }
+        }
+        loaded.finish();
+    });
+
+    std::thread execute_stage([&] {
+        while (auto item = loaded.pop()) {
+            auto timer = stage_scope(prof, "execute block " + std::to_string(item->index));
+            executed_type result{.index = item->index};
+            auto err = m_runner.execute_block(std::move(item->block), std::move(item->messages),
+                                              item->origin, result.assignments);
+            if (err) {
+                error.fail("Block " + std::to_string(item->index) + ": " + err.value(), loaded,
+                           executed, serialized);
+                return;
+            }
+            auto bytes = estimate_bytes(result.assignments);
+            timer.add_counter("table_bytes", static_cast<std::int64_t>(bytes));
+            // Text export needs tables in memory
+            if (m_options.spill_directory && !artifacts.has_value() &&
+                bytes > m_options.memory_budget / 2) {
+                // Spilled tables are not checked later, check them while they are in memory
+                if (!check_tables(item->index, result.assignments)) {
+                    return;
+                }
+                for (auto& [circuit, table] : result.assignments) {
+                    err = spilled_table<Endianness, ArithmetizationType>::spill(
+                        std::move(table), *m_options.spill_directory, result.spilled[circuit]);
+                    if (err) {
+                        error.fail("Block " + std::to_string(item->index) + ": " + err.value(),
+                                   loaded, executed, serialized);
+                        return;
+                    }
+                }
+                result.assignments.clear();
+                result.is_spilled = true;
+                BOOST_LOG_TRIVIAL(debug) << "tables of block " << item->index << " of " << bytes
+                                         << " bytes are spilled to "
+                                         << *m_options.spill_directory;
+                // Mapped pages are evictable, spilled tables take a queue slot only
+                bytes = 0;
+            }
+            if (!executed.push(std::move(result), bytes)) {
+                return;
+            }
+        }
+        executed.finish();
+    });
+
+    const auto& table_options = m_runner.get_table_output_options();
+    std::thread serialize_stage([&] {
+        static_columns_cache<Endianness, ArithmetizationType, BlueprintFieldType> static_cache;
+        std::unordered_set<std::string> written_static_columns;
+        auto compress = [&](std::string content) {
+            if (table_options.compression.codec == compression_codec::none) {
+                return content;
+            }
+            return compress_chunked(content, table_options.compression);
+        };
+        // Adds static columns of the table to output files unless they are written already
+        auto share_static_columns = [&](std::size_t circuit, const auto& table,
+                                        const std::string& filename, serialized_type& result) {
+            const auto& shared = static_cache.get(circuit, table, table_options.format);
+            auto shared_filename = shared.filename(filename, table_options.compression.codec);
+            if (written_static_columns.insert(shared_filename).second &&
+                !std::filesystem::exists(shared_filename)) {
+                result.files.push_back(
+                    {std::move(shared_filename), compress(shared.content), true});
+            }
+            return shared.digest;
+        };
+
+        while (auto item = executed.pop()) {
+            auto timer = stage_scope(prof, "serialize block " + std::to_string(item->index));
+            const auto basefilename = block_file_name(assignment_table_file_name, item->index);
+            serialized_type result{.index = item->index};
+            std::size_t bytes = 0;
+            if (item->is_spilled) {
+                if (table_options.shared_static_columns) {
+                    for (const auto& [circuit, table] : item->spilled) {
+                        result.static_digests[circuit] = share_static_columns(
+                            circuit, table, basefilename + "." + std::to_string(circuit),
+                            result);
+                    }
+                }
+                // Tables stay in mapped files, buffering their content would defeat spilling
+                result.spilled = std::move(item->spilled);
+                item.reset();
+                for (const auto& file : result.files) {
+                    bytes += file.content.size();
+                }
+                if (!serialized.push(std::move(result), bytes)) {
+                    return;
+                }
+                continue;
+            }
+            if (!check_tables(item->index, item->assignments)) {
+                return;
+            }
+            for (const auto& [circuit, table] : item->assignments) {
+                const auto filename = basefilename + "." + std::to_string(circuit);
+                const auto rows = usable_rows(table);
+                const auto segments = plan_table_segments(rows, filename, table_options);
+                std::optional<core::mpt::NodeKey> static_digest;
+                if (table_options.shared_static_columns) {
+                    static_digest = share_static_columns(circuit, table, filename, result);
+                }
+                for (const auto& segment : segments) {
+                    std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+                    if (static_digest) {
+                        write_binary_assignment_shared<Endianness, ArithmetizationType,
+                                                       BlueprintFieldType>(
+                            table, segment.begin, segment.end, *static_digest, out,
+                            table_options.format);
+                    } else {
+                        write_binary_assignment<Endianness, ArithmetizationType,
+                                                BlueprintFieldType>(
+                            table, segment.begin, segment.end, out, table_options.format);
+                    }
+                    result.files.push_back({segment.filename, compress(std::move(out).str())});
+                }
+                if (table_options.write_digest) {
+                    result.files.push_back(
+                        {digest_manifest_name(filename),
+                         compute_table_digest<BlueprintFieldType>(table).to_json(circuit)});
+                }
+                if (table_options.segment_rows) {
+                    result.files.push_back(
+                        {filename + ".segments.json",
+                         table_segments_metadata(circuit, rows, segments, table_options)});
+                }
+            }
+            for (const auto& file : result.files) {
+                bytes += file.content.size();
+            }
+            if (artifacts.has_value()) {
+                auto block_artifacts = artifacts.value();
+                if (!block_artifacts.to_stdout()) {
+                    block_artifacts.basename =
+                        block_file_name(block_artifacts.basename, item->index);
+                }
+                auto err =
+                    write_output_artifacts<Endianness, ArithmetizationType, BlueprintFieldType>(
+                        item->assignments, block_artifacts, table_options.compression);
+                if (err) {
+                    error.fail("Block " + std::to_string(item->index) + ": " + err.value(),
+                               loaded, executed, serialized);
+                    return;
+                }
+            }
+            // Tables are released here, before waiting for space in the write queue
+            item.reset();
+            timer.add_counter("serialized_bytes", static_cast<std::int64_t>(bytes));
+            if (!serialized.push(std::move(result), bytes)) {
+                return;
+            }
+        }
+        serialized.finish();
+    });
+
+    while (auto item = serialized.pop()) {
+        auto timer = stage_scope(prof, "write block " + std::to_string(item->index));
+        auto write_files = [&]() -> std::optional<std::string> {
+            for (const auto& [filename, content, shared] : item->files) {
+                if (shared) {
+                    BOOST_LOG_TRIVIAL(debug) << "writing static columns into file " << filename;
+                    auto err = write_file_atomically(filename, content);
+                    if (err) {
+                        return err;
+                    }
+                    continue;
+                }
+                BOOST_LOG_TRIVIAL(debug) << "writing table into file " << filename;
+                std::ofstream fout(filename, std::ios_base::binary | std::ios_base::out);
+                if (!fout.is_open()) {
+                    return "Cannot open " + filename;
+                }
+                fout.write(content.data(), static_cast<std::streamsize>(content.size()));
+                fout.close();
+                if (!fout) {
+                    return "Failed to write " + filename;
+                }
+            }
+            const auto basefilename = block_file_name(assignment_table_file_name, item->index);
+            for (const auto& [circuit, table] : item->spilled) {
+                const auto digest = item->static_digests.find(circuit);
+                auto err =
+                    write_binary_table_files<Endianness, ArithmetizationType, BlueprintFieldType>(
+                        circuit, table, basefilename + "." + std::to_string(circuit),
+                        table_options,
+                        digest != item->static_digests.end() ? &digest->second : nullptr);
+                if (err) {
+                    return "Block " + std::to_string(item->index) + ": " + err.value();
+                }
+            }
+            return {};
+        };
+        auto err = write_files();
+        if (err) {
+            error.fail(std::move(*err), loaded, executed, serialized);
+        }
+    }
+
+    fetch_stage.join();
+    execute_stage.join();
+    serialize_stage.join();
+    return error.get();
+}
+
+// Instantiate pipeline for required field types
+
+using pallas_base_field = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+template class block_pipeline<pallas_base_field>;
+
+using bls_base_field = typename nil::crypto3::algebra::fields::bls12_base_field<381>;
+template class block_pipeline<bls_base_field>;
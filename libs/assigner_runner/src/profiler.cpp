@@ -0,0 +1,144 @@
+#include "zkevm_framework/assigner_runner/profiler.hpp"
+
+#include <atomic>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/serialize.hpp>
+#include <fstream>
+#include <utility>
+
+namespace {
+    // Thread ids of the standard library are opaque, trace viewers expect small integers
+    std::uint64_t current_thread_id() {
+        static std::atomic<std::uint64_t> next_id{0};
+        thread_local const std::uint64_t id = next_id.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+}  // namespace
+
+std::uint64_t& allocation_counter() {
+    // Constant initialized, so operator new may advance it at any point of thread life
+    thread_local std::uint64_t counter = 0;
+    return counter;
+}
+
+profiler::scoped_timer::scoped_timer(profiler* owner, std::string name, std::string category)
+    : m_owner(owner),
+      m_event{.name = std::move(name),
+              .category = std::move(category),
+              .thread_id = current_thread_id()},
+      m_start(std::chrono::steady_clock::now()),
+      m_start_allocated(allocation_counter()) {}
+
+profiler::scoped_timer::scoped_timer(scoped_timer&& other) noexcept
+    : m_owner(std::exchange(other.m_owner, nullptr)),
+      m_event(std::move(other.m_event)),
+      m_start(other.m_start),
+      m_start_allocated(other.m_start_allocated) {}
+
+profiler::scoped_timer& profiler::scoped_timer::operator=(scoped_timer&& other) noexcept {
+    if (this != &other) {
+        stop();
+        m_owner = std::exchange(other.m_owner, nullptr);
+        m_event = std::move(other.m_event);
+        m_start = other.m_start;
+        m_start_allocated = other.m_start_allocated;
+    }
+    return *this;
+}
+
+profiler::scoped_timer::~scoped_timer() { stop(); }
+
+void profiler::scoped_timer::add_counter(const std::string& name, std::int64_t value) {
+    if (m_owner != nullptr) {
+        m_event.counters[name] = value;
+    }
+}
+
+void profiler::scoped_timer::stop() {
+    if (m_owner == nullptr) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    m_event.start =
+        std::chrono::duration_cast<std::chrono::microseconds>(m_start - m_owner->m_origin);
+    m_event.duration = std::chrono::duration_cast<std::chrono::microseconds>(now - m_start);
+    m_event.allocated_bytes = allocation_counter() - m_start_allocated;
+    std::exchange(m_owner, nullptr)->record(std::move(m_event));
+}
+
+profiler::profiler() : m_origin(std::chrono::steady_clock::now()) {}
+
+profiler::scoped_timer profiler::scope(std::string name, std::string category) {
+    return scoped_timer(this, std::move(name), std::move(category));
+}
+
+void profiler::record(event e) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.push_back(std::move(e));
+}
+
+std::vector<profiler::event> profiler::events() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events;
+}
+
+std::optional<std::string> profiler::dump(const std::string& file_name,
+                                          output_format format) const {
+    std::ofstream out(file_name);
+    if (!out.is_open()) {
+        return "Could not open the profile file: '" + file_name + "'";
+    }
+
+    boost::json::array events_json;
+    for (const auto& e : events()) {
+        boost::json::object counters;
+        for (const auto& [name, value] : e.counters) {
+            counters[name] = value;
+        }
+        boost::json::object event_json;
+        event_json["name"] = e.name;
+        if (format == output_format::chrome) {
+            // Complete events of Chrome trace format, see chrome://tracing
+            counters["allocated_bytes"] = e.allocated_bytes;
+            event_json["cat"] = e.category;
+            event_json["ph"] = "X";
+            event_json["ts"] = e.start.count();
+            event_json["dur"] = e.duration.count();
+            event_json["pid"] = 0;
+            event_json["tid"] = e.thread_id;
+            event_json["args"] = std::move(counters);
+        } else {
+            event_json["category"] = e.category;
+            event_json["thread_id"] = e.thread_id;
+            event_json["start_us"] = e.start.count();
+            event_json["duration_us"] = e.duration.count();
+            event_json["allocated_bytes"] = e.allocated_bytes;
+            event_json["counters"] = std::move(counters);
+        }
+        events_json.push_back(std::move(event_json));
+    }
+
+    boost::json::object result;
+    if (format == output_format::chrome) {
+        result["traceEvents"] = std::move(events_json);
+        result["displayTimeUnit"] = "ms";
+    } else {
+        result["events"] = std::move(events_json);
+    }
+    out << boost::json::serialize(result) << std::endl;
+    if (!out) {
+        return "Failed writing the profile file: '" + file_name + "'";
+    }
+    return {};
+}
+
+std::optional<profiler::output_format> profiler::parse_format(const std::string& name) {
+    if (name == "json") {
+        return output_format::json;
+    }
+    if (name == "chrome") {
+        return output_format::chrome;
+    }
+    return std::nullopt;
+}
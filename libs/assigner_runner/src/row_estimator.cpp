@@ -0,0 +1,87 @@
+#include "zkevm_framework/assigner_runner/row_estimator.hpp"
+
+#include <cmath>
+#include <string_view>
+#include <unordered_set>
+
+#include "zkevm_framework/assigner_runner/utils.hpp"
+
+std::optional<std::string> row_estimate::check_limit(std::size_t max_rows) const {
+    for (const auto& [circuit, circuit_rows] : rows) {
+        if (circuit_rows > max_rows) {
+            return "Block needs about " + std::to_string(circuit_rows) + " rows in table " +
+                   std::to_string(circuit) + ", limit is " + std::to_string(max_rows);
+        }
+    }
+    return {};
+}
+
+row_estimator::row_estimator() {
+    m_models[nil::evm_assigner::zkevm_circuit::BYTECODE] = {.per_contract = 1,
+                                                            .per_code_byte = 1};
+}
+
+void row_estimator::set_model(nil::evm_assigner::zkevm_circuit circuit, const row_model& model) {
+    m_models[circuit] = model;
+}
+
+template<typename Message>
+void row_estimator::count_message(const Message& msg, std::uint64_t gas_price,
+                                  const evmc::accounts& accounts,
+                                  std::unordered_set<std::string_view>& codes,
+                                  row_estimate& result) const {
+    // Same as the runner: external deploy messages are not executed
+    if (!msg.flags().test(std::size_t(core::types::MessageKind::Internal)) &&
+        msg.flags().test(std::size_t(core::types::MessageKind::Deploy))) {
+        return;
+    }
+    ++result.messages;
+    if (gas_price != 0) {
+        result.gas += (msg.fee_credit().m_value / gas_price)[0];
+    }
+    const auto account = accounts.find(to_evmc_address(msg.to()));
+    if (account == accounts.end() || account->second.code.empty()) {
+        return;
+    }
+    const auto& code = account->second.code;
+    if (codes.emplace(reinterpret_cast<const char*>(code.data()), code.size()).second) {
+        ++result.contracts;
+        result.code_bytes += code.size();
+    }
+}
+
+void row_estimator::apply_models(row_estimate& result) const {
+    for (const auto& [circuit, model] : m_models) {
+        const double rows = model.base + model.per_message * result.messages +
+                            model.per_contract * result.contracts +
+                            model.per_code_byte * result.code_bytes +
+                            model.per_gas * static_cast<double>(result.gas);
+        result.rows[circuit] = static_cast<std::size_t>(std::ceil(rows));
+    }
+}
+
+row_estimate row_estimator::estimate(const core::types::Block& block,
+                                     const std::vector<core::types::Message>& messages,
+                                     const evmc::accounts& accounts) const {
+    row_estimate result;
+    std::unordered_set<std::string_view> codes;
+    const auto gas_price = block.m_gasPrice.m_value[0];
+    for (const auto& msg : messages) {
+        count_message(msg, gas_price, accounts, codes, result);
+    }
+    apply_models(result);
+    return result;
+}
+
+row_estimate row_estimator::estimate(const core::types::Block& block,
+                                     const input_messages& messages,
+                                     const evmc::accounts& accounts) const {
+    row_estimate result;
+    std::unordered_set<std::string_view> codes;
+    const auto gas_price = block.m_gasPrice.m_value[0];
+    messages.for_each([&](const auto& msg) {
+        count_message(msg, gas_price, accounts, codes, result);
+    });
+    apply_models(result);
+    return result;
+}
@@ -17,22 +17,128 @@ template<typename BlueprintFieldType>
 std::optional<std::string> single_thread_runner<BlueprintFieldType>::run(
     const std::string& assignment_table_file_name,
     const std::optional<OutputArtifacts>& artifacts) {
-    fill_assignments();
+    auto err = execute();
+    if (err) {
+        return err;
+    }
+    return write_outputs(m_assignments, assignment_table_file_name, artifacts);
+}
+
+template<typename BlueprintFieldType>
+std::optional<std::string> single_thread_runner<BlueprintFieldType>::execute() {
+    // Blocks parsed from JSON don't carry the root
+    if (m_check_messages_root && m_current_block_origin != block_origin::json_file) {
+        auto root_timer = profile_scope("messages_root");
+        const auto root = in_messages_trie_root(m_input_messages);
+        root_timer.stop();
+        if (root != m_current_block.m_in_messages_root) {
+            return "Root of input messages is " + to_str(root) + ", block header has " +
+                   to_str(m_current_block.m_in_messages_root);
+        }
+    }
+    if (m_record_block_roots || m_expected_block_roots) {
+        auto roots_timer = profile_scope("block_roots");
+        const auto roots = compute_block_roots(m_current_block, m_input_messages);
+        roots_timer.stop();
+        const auto index = m_block_roots.size();
+        m_block_roots.push_back(roots);
+        if (m_expected_block_roots) {
+            if (index >= m_expected_block_roots->size()) {
+                return "No expected roots of block " + std::to_string(index);
+            }
+            const auto& expected = (*m_expected_block_roots)[index];
+            if (roots.block != expected.block) {
+                return "Root of block " + std::to_string(index) + " is " + to_str(roots.block) +
+                       ", expected " + to_str(expected.block);
+            }
+            if (roots.in_messages != expected.in_messages) {
+                return "Root of input messages of block " + std::to_string(index) + " is " +
+                       to_str(roots.in_messages) + ", expected " + to_str(expected.in_messages);
+            }
+        }
+    }
+
+    auto estimate_timer = profile_scope("estimate_rows");
+    const auto estimate =
+        m_row_estimator.estimate(m_current_block, m_input_messages, m_account_storage);
+    estimate_timer.stop();
+    for (const auto& [circuit, rows] : estimate.rows) {
+        BOOST_LOG_TRIVIAL(debug) << "estimated rows of table " << circuit << ": " << rows
+                                 << " (" << estimate.contracts << " contracts, "
+                                 << estimate.code_bytes << " code bytes, " << estimate.gas
+                                 << " gas)\n";
+    }
+    if (m_max_rows) {
+        // Fail before spending time on the block which does not fit anyway
+        auto err = estimate.check_limit(*m_max_rows);
+        if (err) {
+            return err;
+        }
+    }
+
+    auto fill_timer = profile_scope("fill_assignments");
+    auto err = fill_assignments();
+    if (err) {
+        return err;
+    }
+    fill_timer.stop();
+
+    if (!m_max_rows) {
+        return {};
+    }
+    for (const auto& [circuit, table] : m_assignments) {
+        const auto used_rows = filled_rows(table);
+        const auto it = estimate.rows.find(circuit);
+        if (it != estimate.rows.end()) {
+            BOOST_LOG_TRIVIAL(debug) << "table " << circuit << " uses " << used_rows
+                                     << " rows, estimated " << it->second << "\n";
+        }
+        if (used_rows > *m_max_rows) {
+            return "Table " + std::to_string(circuit) + " uses " + std::to_string(used_rows) +
+                   " rows, limit is " + std::to_string(*m_max_rows);
+        }
+    }
+    return {};
+}
+
+template<typename BlueprintFieldType>
+std::optional<std::string> single_thread_runner<BlueprintFieldType>::execute_block(
+    core::types::Block block, input_messages messages, block_origin origin,
+    assignments_type& assignments) {
+    if (!m_preset_assignments) {
+        m_preset_assignments = m_assignments;
+    }
+    m_current_block = std::move(block);
+    m_current_block_origin = origin;
+    m_input_messages = std::move(messages);
+    auto err = execute();
+    assignments = std::move(m_assignments);
+    m_assignments = *m_preset_assignments;
+    return err;
+}
 
-    BOOST_LOG_TRIVIAL(debug) << "print assignment tables " << m_assignments.size() << "\n";
+template<typename BlueprintFieldType>
+std::optional<std::string> single_thread_runner<BlueprintFieldType>::write_outputs(
+    const assignments_type& assignments, const std::string& assignment_table_file_name,
+    const std::optional<OutputArtifacts>& artifacts) const {
+    BOOST_LOG_TRIVIAL(debug) << "print assignment tables " << assignments.size() << "\n";
 
     using Endianness = nil::marshalling::option::big_endian;
 
+    auto write_timer = profile_scope("write_binary_assignments");
     auto err = write_binary_assignments<Endianness, ArithmetizationType, BlueprintFieldType>(
-        m_assignments, assignment_table_file_name);
+        assignments, assignment_table_file_name, m_table_output_options,
+        &m_static_columns_cache);
     if (err) {
         return err;
     }
+    write_timer.stop();
 
     if (artifacts.has_value()) {
+        auto artifacts_timer = profile_scope("write_output_artifacts");
         std::optional<std::string> err =
             write_output_artifacts<Endianness, ArithmetizationType, BlueprintFieldType>(
-                m_assignments, artifacts.value());
+                assignments, artifacts.value(), m_table_output_options.compression);
         if (err) {
             return err;
         }
@@ -44,16 +150,28 @@ std::optional<std::string> single_thread_runner<BlueprintFieldType>::run(
 template<typename BlueprintFieldType>
 std::optional<std::string> single_thread_runner<BlueprintFieldType>::extract_block_with_messages(
     const std::string& blockHash, const std::string& block_file_name) {
+    return load_block(blockHash, block_file_name, m_current_block, m_input_messages,
+                      m_current_block_origin);
+}
+
+template<typename BlueprintFieldType>
+std::optional<std::string> single_thread_runner<BlueprintFieldType>::load_block(
+    const std::string& blockHash, const std::string& block_file_name, core::types::Block& block,
+    input_messages& messages, block_origin& origin) const {
+    auto timer = profile_scope("extract_block_with_messages");
     if (!block_file_name.empty()) {
         BOOST_LOG_TRIVIAL(debug) << "Try load input block from file " << block_file_name << "\n";
         std::ifstream block_data(block_file_name);
         if (!block_data.is_open()) {
             return "Could not open the input block file: '" + block_file_name + "'";
         }
-        const auto err = load_block_with_messages(m_current_block, m_input_messages, block_data);
+        std::vector<core::types::Message> parsed;
+        const auto err = load_block_with_messages(block, parsed, block_data);
         if (err) {
             return err;
         }
+        messages = input_messages(std::move(parsed));
+        origin = block_origin::json_file;
     } else {
         BOOST_LOG_TRIVIAL(debug) << "Try get input block from RPC\n";
         std::stringstream block_data;
@@ -61,10 +179,11 @@ std::optional<std::string> single_thread_runner<BlueprintFieldType>::extract_blo
         if (err) {
             return err;
         }
-        err = load_raw_block_with_messages(m_current_block, m_input_messages, block_data);
+        err = load_raw_block_with_messages(block, messages, block_data);
         if (err) {
             return err;
         }
+        origin = block_origin::rpc;
     }
     return {};
 }
@@ -72,6 +191,7 @@ std::optional<std::string> single_thread_runner<BlueprintFieldType>::extract_blo
 template<typename BlueprintFieldType>
 std::optional<std::string> single_thread_runner<BlueprintFieldType>::extract_accounts_with_storage(
     const std::string& account_storage_config_name) {
+    auto timer = profile_scope("extract_accounts_with_storage");
     if (!account_storage_config_name.empty()) {
         BOOST_LOG_TRIVIAL(debug) << "Try load account storage from file "
                                  << account_storage_config_name << "\n";
@@ -85,8 +205,6 @@ std::optional<std::string> single_thread_runner<BlueprintFieldType>::extract_acc
 
 template<typename BlueprintFieldType>
 std::optional<std::string> single_thread_runner<BlueprintFieldType>::fill_assignments() {
-    std::ostringstream error;
-
     // create assigner instance
     auto assigner_ptr =
         std::make_shared<nil::evm_assigner::assigner<BlueprintFieldType>>(m_assignments);
@@ -159,81 +277,85 @@ std::optional<std::string> single_thread_runner<BlueprintFieldType>::fill_assign
     std::string target_circuit = m_target_circuits.size() > 0 ? m_target_circuits[0] : "";
     ExtVMHost host(m_extractor, to_str(m_current_block.m_prev_block), tx_context, m_account_storage,
                    assigner_ptr, target_circuit);
+    if (m_lazy_storage) {
+        host.enable_lazy_storage(m_lazy_storage.value());
+    }
 
     struct evmc_host_context* ctx = host.to_context();
 
-    // run EVM per transactions
-    for (const auto& input_msg : m_input_messages) {
-        const evmc_address origin_addr = to_evmc_address(input_msg.m_from);
+    // run EVM per transactions, parsed messages and views over serialized ones have the same
+    // accessors
+    std::optional<std::string> message_error;
+    m_input_messages.for_each([&](const auto& input_msg) {
+        if (message_error) {
+            return;
+        }
+        auto message_timer =
+            profile_scope("message " + std::to_string(input_msg.seqno()), "message");
+        const evmc_address origin_addr = to_evmc_address(input_msg.from());
         tx_context.tx_origin = origin_addr;
 
-        BOOST_LOG_TRIVIAL(debug) << "process CALL message\n  from " << to_str(input_msg.m_from)
-                                 << " to " << to_str(input_msg.m_to) << "\n";
+        BOOST_LOG_TRIVIAL(debug) << "process CALL message\n  from " << to_str(input_msg.from())
+                                 << " to " << to_str(input_msg.to()) << "\n";
 
-        if (!input_msg.m_flags.test(std::size_t(core::types::MessageKind::Internal)) &&
-            input_msg.m_flags.test(std::size_t(core::types::MessageKind::Deploy))) {
-            BOOST_LOG_TRIVIAL(debug) << "skip transaction " << input_msg.m_seqno << "("
-                                     << to_str(input_msg.m_flags) << "). Nothing to do\n";
-            continue;
+        if (!input_msg.flags().test(std::size_t(core::types::MessageKind::Internal)) &&
+            input_msg.flags().test(std::size_t(core::types::MessageKind::Deploy))) {
+            BOOST_LOG_TRIVIAL(debug) << "skip transaction " << input_msg.seqno() << "("
+                                     << to_str(input_msg.flags()) << "). Nothing to do\n";
+            return;
         }
 
         // set tansaction related fields
         // tx_context.tx_gas_price =
         // intx::be::store<evmc::uint256be>(input_msg.m_gas_price.m_value);
-        auto msg_calldata = input_msg.m_data;
-        std::vector<uint8_t> calldata(msg_calldata.size());
-        size_t count = 0;
-        std::for_each(msg_calldata.begin(), msg_calldata.end(),
-                      [&count, &calldata](const std::byte& v) {
-                          calldata[count] = to_integer<uint8_t>(v);
-                          count++;
-                      });
-        if (count != calldata.size()) {
-            error << "Failed copy calldata: expected size = " << calldata.size()
-                  << ", real = " << count;
-            return error.str();
-        }
+
+        // Calldata and code are passed as views, neither is copied per message
+        const auto calldata = input_msg.data();
 
         // init messge associated with transaction
-        const evmc_uint256be value = to_uint256be(input_msg.m_value.m_value);
-        const evmc_address sender_addr = to_evmc_address(input_msg.m_from);
-        const evmc_address recipient_addr = to_evmc_address(input_msg.m_to);
+        const evmc_uint256be value = to_uint256be(input_msg.value().m_value);
+        const evmc_address sender_addr = to_evmc_address(input_msg.from());
+        const evmc_address recipient_addr = to_evmc_address(input_msg.to());
+        const auto contract_code = host.get_cached_code(recipient_addr, m_code_cache);
         const int64_t gas =
-            (input_msg.m_feeCredit.m_value / (m_current_block.m_gasPrice.m_value[0]))[0];
+            (input_msg.fee_credit().m_value / (m_current_block.m_gasPrice.m_value[0]))[0];
         const uint8_t input[] = "";
-        struct evmc_message msg = {.kind = evmc_msg_kind(input_msg.m_flags),
+        struct evmc_message msg = {.kind = evmc_msg_kind(input_msg.flags()),
                                    .flags = uint32_t{0},
                                    .depth = 0,
                                    .gas = gas,
                                    .recipient = recipient_addr,
                                    .sender = sender_addr,
-                                   .input_data = calldata.data(),
+                                   .input_data = reinterpret_cast<const uint8_t*>(calldata.data()),
                                    .input_size = calldata.size(),
                                    .value = value,
                                    .create2_salt = {0},
                                    .code_address = origin_addr};
 
-        std::vector<uint8_t> contract_code;
-        contract_code.resize(host.get_code_size(recipient_addr));
-        const auto copy_size =
-            host.copy_code(recipient_addr, 0, contract_code.data(), contract_code.size());
-        if (copy_size != contract_code.size()) {
-            error << "Failed copy contract code: expected size = " << contract_code.size()
-                  << ", real = " << copy_size;
-            return error.str();
-        }
 
         BOOST_LOG_TRIVIAL(debug) << "evaluate transaction\n"
-                                 << "  type = " << to_str(input_msg.m_flags) << "\n"
-                                 << "  value = " << input_msg.m_value.m_value[0] << "\n"
+                                 << "  type = " << to_str(input_msg.flags()) << "\n"
+                                 << "  value = " << input_msg.value().m_value[0] << "\n"
                                  << "  gas price = " << m_current_block.m_gasPrice.m_value[0]
                                  << "\n"
-                                 << "  free credit = " << input_msg.m_feeCredit.m_value[0] << "\n"
+                                 << "  free credit = " << input_msg.fee_credit().m_value[0] << "\n"
                                  << "  gas = " << gas << "\n"
-                                 << "  code size = " << contract_code.size() << "\n";
-
-        auto res = nil::evm_assigner::evaluate(host_interface, ctx, rev, &msg, contract_code.data(),
-                                               contract_code.size(), assigner_ptr, target_circuit);
+                                 << "  code size = " << contract_code->size() << "\n";
+
+        auto evaluate_timer = profile_scope("evaluate", "evaluate");
+        auto res =
+            nil::evm_assigner::evaluate(host_interface, ctx, rev, &msg, contract_code->data(),
+                                        contract_code->size(), assigner_ptr, target_circuit);
+        evaluate_timer.stop();
+        if (auto err = host.take_storage_error()) {
+            message_error = "Message " + std::to_string(input_msg.seqno()) + ": " + err.value();
+            return;
+        }
+        message_timer.add_counter("gas", gas);
+        message_timer.add_counter("gas_used", gas - res.gas_left);
+        message_timer.add_counter("code_size", contract_code->size());
+        message_timer.add_counter("calldata_size", calldata.size());
+        message_timer.add_counter("status_code", res.status_code);
 
         BOOST_LOG_TRIVIAL(debug) << "evaluate result = " << to_str(res.status_code) << "\n";
         if (res.status_code == EVMC_SUCCESS) {
@@ -242,10 +364,35 @@ std::optional<std::string> single_thread_runner<BlueprintFieldType>::fill_assign
                                      << "gas_refund = " << res.gas_refund << "\n"
                                      << "output size = " << res.output_size << "\n";
         }
+    });
+    if (message_error) {
+        return message_error;
+    }
+
+    BOOST_LOG_TRIVIAL(debug) << "Code cache: " << m_code_cache.size() << " contracts, "
+                             << m_code_cache.hits() << " hits, " << m_code_cache.misses()
+                             << " misses\n";
+
+    if (const auto* storage = get_lazy_storage()) {
+        BOOST_LOG_TRIVIAL(debug) << "Lazily loaded " << storage->loaded_slots()
+                                 << " storage slots\n";
+        for (const auto& addr : storage->contracts()) {
+            BOOST_LOG_TRIVIAL(debug) << "  storage root of " << to_str(addr) << " = "
+                                     << to_str(storage->storage_root(addr)) << "\n";
+        }
     }
     return {};
 }
 
+template<typename BlueprintFieldType>
+profiler::scoped_timer single_thread_runner<BlueprintFieldType>::profile_scope(
+    std::string name, std::string category) const {
+    if (m_profiler == nullptr) {
+        return {};
+    }
+    return m_profiler->scope(std::move(name), std::move(category));
+}
+
 // Instantiate runner for required field types
 
 using pallas_base_field = typename nil::crypto3::algebra::curves::pallas::base_field_type;
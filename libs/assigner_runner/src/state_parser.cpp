@@ -36,7 +36,8 @@ static std::optional<std::string> handle_storage(const boost::json::array &stora
 }
 
 static std::optional<std::string> handle_account(std::string &contract_str, evmc::account &account,
-                                                 evmc::address &address) {
+                                                 evmc::address &address,
+                                                 core::Hash *storage_root = nullptr) {
     core::types::SmartContract contract;
     std::vector<std::byte> contract_data;
     auto parse_err = json_helpers::to_std_bytes(contract_str, contract_data);
@@ -46,6 +47,9 @@ static std::optional<std::string> handle_account(std::string &contract_str, evmc
     contract = ssz::deserialize<core::types::SmartContract>(contract_data);
     account.balance = to_uint256be(contract.m_balance.m_value);
     address = to_evmc_address(contract.m_address);
+    if (storage_root != nullptr) {
+        *storage_root = contract.m_storage_root;
+    }
     return {};
 }
 
@@ -99,8 +103,9 @@ std::optional<std::string> init_account_storage(evmc::accounts &account_storage,
     return init_account_storage(account_storage, asc_stream);
 }
 
-std::optional<std::string> load_account_with_storage(evmc::account &account,
-                                                     std::istream &account_data) {
+static std::optional<std::string> load_account_from_rpc(evmc::account &account,
+                                                        core::Hash *storage_root,
+                                                        std::istream &account_data) {
     auto account_json = json_helpers::parse_json(account_data);
     if (!account_json) {
         return "Error while parsing accounts data: " + account_json.error();
@@ -121,11 +126,15 @@ std::optional<std::string> load_account_with_storage(evmc::account &account,
     }
     std::string contract_str = account_json.value().at("result").at("contract").as_string().c_str();
     evmc::address address;
-    parse_err = handle_account(contract_str, account, address);
+    parse_err = handle_account(contract_str, account, address, storage_root);
     if (parse_err) {
         return "Parse account failed: \n\t" + parse_err.value();
     }
 
+    // Storage is loaded lazily if the caller asked for the storage root
+    if (storage_root != nullptr) {
+        return {};
+    }
     if (!account_json.value().as_object().contains("result") ||
         !account_json.value().at("result").as_object().contains("storage")) {
         return "Storage is not found in the JSON";
@@ -136,3 +145,27 @@ std::optional<std::string> load_account_with_storage(evmc::account &account,
     }
     return {};
 }
+
+std::optional<std::string> load_account_with_storage(evmc::account &account,
+                                                     std::istream &account_data) {
+    return load_account_from_rpc(account, nullptr, account_data);
+}
+
+std::optional<std::string> load_account(evmc::account &account, core::Hash &storage_root,
+                                        std::istream &account_data) {
+    return load_account_from_rpc(account, &storage_root, account_data);
+}
+
+std::optional<std::string> load_storage_slot(evmc::bytes32 &value, std::istream &slot_data) {
+    auto slot_json = json_helpers::parse_json(slot_data);
+    if (!slot_json) {
+        return "Error while parsing storage slot data: " + slot_json.error();
+    }
+    if (!slot_json.value().as_object().contains("result") ||
+        !slot_json.value().at("result").is_string()) {
+        return "Storage slot value is not found in the JSON";
+    }
+    const auto val_str = slot_json.value().at("result").as_string().c_str();
+    value = to_uint256be(intx::from_string<intx::uint256>(val_str));
+    return {};
+}
@@ -0,0 +1,305 @@
+#include "zkevm_framework/assigner_runner/table_digest.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <boost/algorithm/hex.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <iterator>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+#include "zkevm_framework/core/mpt/hasher.hpp"
+
+namespace {
+    std::string to_hex(const core::mpt::NodeKey& key) {
+        std::string hex;
+        const auto bytes = key.bytes();
+        boost::algorithm::hex_lower(reinterpret_cast<const char*>(bytes.data()),
+                                    reinterpret_cast<const char*>(bytes.data()) + bytes.size(),
+                                    std::back_inserter(hex));
+        return hex;
+    }
+
+    std::optional<core::mpt::NodeKey> from_hex(const boost::json::value& value) {
+        if (!value.is_string()) {
+            return std::nullopt;
+        }
+        std::string bytes;
+        try {
+            boost::algorithm::unhex(value.as_string().begin(), value.as_string().end(),
+                                    std::back_inserter(bytes));
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+        if (bytes.empty() || bytes.size() > core::mpt::NodeKey::kMaxSize) {
+            return std::nullopt;
+        }
+        return core::mpt::NodeKey(std::as_bytes(std::span(bytes)));
+    }
+
+    core::mpt::NodeKey hash_digests(const std::string& prefix,
+                                    const std::vector<core::mpt::NodeKey>& digests) {
+        std::string data = prefix;
+        for (const auto& digest : digests) {
+            const auto bytes = digest.bytes();
+            data.append(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+        return core::mpt::Keccak256Hasher().Hash(std::as_bytes(std::span(data)));
+    }
+
+    // Rows of chunks as ranges, adjacent chunks are merged
+    std::string chunk_ranges(const std::vector<std::size_t>& chunks, std::size_t chunk_rows,
+                             std::size_t usable_rows) {
+        std::ostringstream out;
+        for (std::size_t i = 0; i < chunks.size();) {
+            std::size_t j = i + 1;
+            while (j < chunks.size() && chunks[j] == chunks[j - 1] + 1) {
+                ++j;
+            }
+            const std::size_t first = chunks[i] * chunk_rows;
+            const std::size_t last = std::min((chunks[j - 1] + 1) * chunk_rows, usable_rows);
+            out << (i == 0 ? "" : ", ") << first << "-" << (last == 0 ? 0 : last - 1);
+            i = j;
+        }
+        return out.str();
+    }
+}  // namespace
+
+std::string table_digest::to_json(std::size_t circuit) const {
+    boost::json::array columns_json;
+    for (const auto& column : columns) {
+        boost::json::array chunks_json;
+        for (const auto& chunk : column.chunks) {
+            chunks_json.push_back(boost::json::string(to_hex(chunk)));
+        }
+        columns_json.push_back(boost::json::object{
+            {"name", column.name},
+            {"digest", to_hex(column.digest)},
+            {"chunks", std::move(chunks_json)},
+        });
+    }
+    return boost::json::serialize(boost::json::object{
+        {"circuit", circuit},
+        {"usable_rows", usable_rows},
+        {"chunk_rows", chunk_rows},
+        {"digest", to_hex(digest)},
+        {"columns", std::move(columns_json)},
+    });
+}
+
+std::optional<std::string> table_digest::from_json(const std::string& json,
+                                                   table_digest& result) {
+    boost::json::error_code ec;
+    const auto value = boost::json::parse(json, ec);
+    if (ec || !value.is_object()) {
+        return "Digest manifest must be a JSON object";
+    }
+    const auto& object = value.as_object();
+    const auto* usable_rows = object.if_contains("usable_rows");
+    const auto* chunk_rows = object.if_contains("chunk_rows");
+    const auto* digest = object.if_contains("digest");
+    const auto* columns = object.if_contains("columns");
+    if (!usable_rows || !usable_rows->is_number() || !chunk_rows || !chunk_rows->is_number() ||
+        !digest || !columns || !columns->is_array()) {
+        return "Digest manifest misses required fields";
+    }
+    result = {};
+    result.usable_rows = usable_rows->to_number<std::size_t>();
+    result.chunk_rows = chunk_rows->to_number<std::size_t>();
+    auto table_hash = from_hex(*digest);
+    if (!table_hash) {
+        return "Invalid table digest";
+    }
+    result.digest = *table_hash;
+    for (const auto& column_value : columns->as_array()) {
+        const auto* column_object = column_value.if_object();
+        if (!column_object || !column_object->contains("name") ||
+            !column_object->at("name").is_string() || !column_object->contains("chunks") ||
+            !column_object->at("chunks").is_array() || !column_object->contains("digest")) {
+            return "Invalid column in digest manifest";
+        }
+        column_digest column;
+        column.name = column_object->at("name").as_string().c_str();
+        auto column_hash = from_hex(column_object->at("digest"));
+        if (!column_hash) {
+            return "Invalid digest of column " + column.name;
+        }
+        column.digest = *column_hash;
+        for (const auto& chunk : column_object->at("chunks").as_array()) {
+            auto chunk_hash = from_hex(chunk);
+            if (!chunk_hash) {
+                return "Invalid chunk digest of column " + column.name;
+            }
+            column.chunks.push_back(*chunk_hash);
+        }
+        result.columns.push_back(std::move(column));
+    }
+    return {};
+}
+
+std::vector<std::string> table_digest::compare(const table_digest& expected) const {
+    std::vector<std::string> differences;
+    if (digest == expected.digest) {
+        return differences;
+    }
+    if (usable_rows != expected.usable_rows) {
+        differences.push_back("usable rows: " + std::to_string(usable_rows) + ", expected " +
+                              std::to_string(expected.usable_rows));
+    }
+    const bool same_chunks = chunk_rows == expected.chunk_rows;
+    if (!same_chunks) {
+        differences.push_back("chunk rows: " + std::to_string(chunk_rows) + ", expected " +
+                              std::to_string(expected.chunk_rows) +
+                              ", differing rows are not reported");
+    }
+
+    std::unordered_map<std::string, const column_digest*> expected_columns;
+    for (const auto& column : expected.columns) {
+        expected_columns.emplace(column.name, &column);
+    }
+    for (const auto& column : columns) {
+        auto it = expected_columns.find(column.name);
+        if (it == expected_columns.end()) {
+            differences.push_back(column.name + ": unexpected column");
+            continue;
+        }
+        const auto& reference = *it->second;
+        expected_columns.erase(it);
+        if (column.digest == reference.digest) {
+            continue;
+        }
+        if (!same_chunks) {
+            differences.push_back(column.name + ": differs");
+            continue;
+        }
+        std::vector<std::size_t> chunks;
+        for (std::size_t i = 0; i < std::max(column.chunks.size(), reference.chunks.size());
+             i++) {
+            if (i >= column.chunks.size() || i >= reference.chunks.size() ||
+                !(column.chunks[i] == reference.chunks[i])) {
+                chunks.push_back(i);
+            }
+        }
+        differences.push_back(
+            column.name + ": rows " +
+            chunk_ranges(chunks, chunk_rows, std::max(usable_rows, expected.usable_rows)));
+    }
+    for (const auto& column : expected.columns) {
+        if (expected_columns.contains(column.name)) {
+            differences.push_back(column.name + ": missing column");
+        }
+    }
+    if (differences.empty()) {
+        differences.push_back("table digest differs");
+    }
+    return differences;
+}
+
+template<typename BlueprintFieldType, typename TableType>
+table_digest compute_table_digest(const TableType& table, const digest_options& options) {
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using Endianness = nil::marshalling::option::big_endian;
+
+    table_digest result;
+    result.usable_rows = usable_rows(table);
+    result.chunk_rows = std::max<std::size_t>(options.chunk_rows, 1);
+    const std::size_t chunks_amount =
+        (result.usable_rows + result.chunk_rows - 1) / result.chunk_rows;
+
+    // Section and index of every column, columns are taken from the table by workers since
+    // spilled tables return views by value
+    std::vector<std::pair<std::size_t, std::uint32_t>> columns;
+    auto add_columns = [&](const char* name, std::size_t section, std::uint32_t amount) {
+        for (std::uint32_t i = 0; i < amount; i++) {
+            result.columns.push_back({name + std::to_string(i), {}, {}});
+            result.columns.back().chunks.resize(chunks_amount);
+            columns.emplace_back(section, i);
+        }
+    };
+    add_columns("witness", 0, table.witnesses_amount());
+    add_columns("public_input", 1, table.public_inputs_amount());
+    add_columns("constant", 2, table.constants_amount());
+    add_columns("selector", 3, table.selectors_amount());
+    auto write_chunk = [&](const auto& column, std::size_t begin, std::size_t end,
+                           std::ostream& out) {
+        write_vector_value<Endianness, ArithmetizationType>(begin, end, end - begin, column, out);
+    };
+
+    const core::mpt::Keccak256Hasher hasher;
+    const std::size_t tasks = columns.size() * chunks_amount;
+    std::atomic<std::size_t> next = 0;
+    auto worker = [&] {
+        for (auto task = next++; task < tasks; task = next++) {
+            const std::size_t column = task / chunks_amount;
+            const std::size_t chunk = task % chunks_amount;
+            const std::size_t begin = chunk * result.chunk_rows;
+            const std::size_t end = std::min(begin + result.chunk_rows, result.usable_rows);
+            std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+            const auto [section, index] = columns[column];
+            switch (section) {
+                case 0:
+                    write_chunk(table.witness(index), begin, end, out);
+                    break;
+                case 1:
+                    write_chunk(table.public_input(index), begin, end, out);
+                    break;
+                case 2:
+                    write_chunk(table.constant(index), begin, end, out);
+                    break;
+                default:
+                    write_chunk(table.selector(index), begin, end, out);
+                    break;
+            }
+            const auto data = std::move(out).str();
+            result.columns[column].chunks[chunk] = hasher.Hash(std::as_bytes(std::span(data)));
+        }
+    };
+    const std::size_t threads =
+        options.threads != 0 ? options.threads
+                             : std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 1; t < std::min(threads, tasks); ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    std::vector<core::mpt::NodeKey> column_digests;
+    for (auto& column : result.columns) {
+        column.digest = hash_digests(column.name, column.chunks);
+        column_digests.push_back(column.digest);
+    }
+    result.digest = hash_digests(std::to_string(result.usable_rows) + ":" +
+                                     std::to_string(result.chunk_rows),
+                                 column_digests);
+    return result;
+}
+
+// Instantiate digest for required field types
+
+using pallas_base_field = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+using pallas_arithmetization = nil::crypto3::zk::snark::plonk_constraint_system<pallas_base_field>;
+template table_digest compute_table_digest<pallas_base_field>(
+    const nil::blueprint::assignment<pallas_arithmetization>&, const digest_options&);
+template table_digest compute_table_digest<pallas_base_field>(
+    const spilled_table<nil::marshalling::option::big_endian, pallas_arithmetization>&,
+    const digest_options&);
+
+using bls_base_field = typename nil::crypto3::algebra::fields::bls12_base_field<381>;
+using bls_arithmetization = nil::crypto3::zk::snark::plonk_constraint_system<bls_base_field>;
+template table_digest compute_table_digest<bls_base_field>(
+    const nil::blueprint::assignment<bls_arithmetization>&, const digest_options&);
+template table_digest compute_table_digest<bls_base_field>(
+    const spilled_table<nil::marshalling::option::big_endian, bls_arithmetization>&,
+    const digest_options&);
@@ -0,0 +1,272 @@
+#include "zkevm_framework/assigner_runner/workload_generator.hpp"
+
+#include <algorithm>
+#include <boost/algorithm/hex.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/serialize.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include "ssz++.hpp"
+#include "zkevm_framework/core/types/account.hpp"
+
+namespace {
+    // Hand assembled contracts, offsets of jump destinations are noted in comments
+    const std::array<std::vector<std::uint8_t>, kWorkloadContractKinds> kContractCode = {{
+        // counter: sstore(0, sload(0) + 1)
+        {0x60, 0x00, 0x54, 0x60, 0x01, 0x01, 0x60, 0x00, 0x55, 0x00},
+        // storage: for (off = 0; off < calldatasize; off += 32) sstore(off, calldataload(off))
+        {
+            0x60, 0x00,        // PUSH1 0
+            0x5b,              // 0x02: JUMPDEST
+            0x36, 0x81, 0x10,  // CALLDATASIZE DUP2 LT
+            0x15, 0x60, 0x14,  // ISZERO PUSH1 0x14
+            0x57,              // JUMPI
+            0x80, 0x35,        // DUP1 CALLDATALOAD
+            0x81, 0x55,        // DUP2 SSTORE
+            0x60, 0x20, 0x01,  // PUSH1 32 ADD
+            0x60, 0x02, 0x56,  // PUSH1 0x02 JUMP
+            0x5b, 0x00,        // 0x14: JUMPDEST STOP
+        },
+        // hasher: sstore(0, keccak256(calldata))
+        {
+            0x36, 0x60, 0x00, 0x60, 0x00, 0x37,  // CALLDATACOPY(0, 0, calldatasize)
+            0x36, 0x60, 0x00, 0x20,              // SHA3(0, calldatasize)
+            0x60, 0x00, 0x55, 0x00,              // SSTORE(0, hash) STOP
+        },
+        // arithmetic: for (n = calldataload(0), acc = 1; n != 0; n--) acc = acc * 3 + 7;
+        // sstore(0, acc)
+        {
+            0x60, 0x00, 0x35,  // PUSH1 0 CALLDATALOAD
+            0x60, 0x01,        // PUSH1 1
+            0x5b,              // 0x05: JUMPDEST
+            0x81, 0x15,        // DUP2 ISZERO
+            0x60, 0x1a, 0x57,  // PUSH1 0x1a JUMPI
+            0x60, 0x03, 0x02,  // PUSH1 3 MUL
+            0x60, 0x07, 0x01,  // PUSH1 7 ADD
+            0x90, 0x60, 0x01,  // SWAP1 PUSH1 1
+            0x90, 0x03, 0x90,  // SWAP1 SUB SWAP1
+            0x60, 0x05, 0x56,  // PUSH1 0x05 JUMP
+            0x5b,              // 0x1a: JUMPDEST
+            0x60, 0x00, 0x55,  // PUSH1 0 SSTORE
+            0x00,              // STOP
+        },
+    }};
+
+    constexpr std::size_t kWordSize = 32;
+    // Shard of the example block, addresses start with it
+    constexpr std::uint8_t kShardId = 1;
+
+    template<typename Container>
+    std::string to_hex(const Container& bytes) {
+        std::string hex = "0x";
+        const auto* data = reinterpret_cast<const char*>(bytes.data());
+        boost::algorithm::hex_lower(data, data + bytes.size(), std::back_inserter(hex));
+        return hex;
+    }
+
+    core::types::Address make_address(std::mt19937_64& rng) {
+        core::types::Address address;
+        address[0] = std::byte{0};
+        address[1] = std::byte{kShardId};
+        for (std::size_t i = 2; i < address.size(); i++) {
+            address[i] = static_cast<std::byte>(rng());
+        }
+        return address;
+    }
+
+    std::vector<std::uint8_t> make_calldata(workload_contract kind,
+                                            const workload_options& options,
+                                            std::mt19937_64& rng) {
+        std::vector<std::uint8_t> data(std::max<std::size_t>(options.calldata_bytes, 1));
+        for (auto& byte : data) {
+            byte = static_cast<std::uint8_t>(rng());
+        }
+        if (kind == workload_contract::arithmetic) {
+            // The first word is the number of iterations
+            data.resize(std::max(data.size(), kWordSize));
+            std::fill_n(data.begin(), kWordSize, 0);
+            for (std::size_t i = 0; i < sizeof(std::uint64_t); i++) {
+                data[kWordSize - 1 - i] =
+                    static_cast<std::uint8_t>(options.loop_iterations >> (8 * i));
+            }
+        }
+        return data;
+    }
+
+    std::string storage_key(std::size_t slot) {
+        std::array<std::uint8_t, kWordSize> key{};
+        for (std::size_t i = 0; i < sizeof(std::size_t); i++) {
+            key[kWordSize - 1 - i] = static_cast<std::uint8_t>(slot >> (8 * i));
+        }
+        return to_hex(key);
+    }
+}  // namespace
+
+std::string to_string(workload_contract kind) {
+    switch (kind) {
+        case workload_contract::counter:
+            return "counter";
+        case workload_contract::storage:
+            return "storage";
+        case workload_contract::hasher:
+            return "hasher";
+        case workload_contract::arithmetic:
+            return "arithmetic";
+    }
+    return "unknown";
+}
+
+std::expected<std::array<std::size_t, kWorkloadContractKinds>, std::string>
+workload_options::parse_contract_mix(const std::string& mix) {
+    std::array<std::size_t, kWorkloadContractKinds> result{};
+    std::istringstream in(mix);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        const auto colon = item.find(':');
+        const auto name = item.substr(0, colon);
+        std::size_t kind = 0;
+        while (kind < kWorkloadContractKinds &&
+               to_string(static_cast<workload_contract>(kind)) != name) {
+            ++kind;
+        }
+        if (kind == kWorkloadContractKinds) {
+            return std::unexpected("Unknown contract kind '" + name + "'");
+        }
+        if (colon == std::string::npos) {
+            result[kind] = 1;
+            continue;
+        }
+        try {
+            std::size_t parsed = 0;
+            result[kind] = std::stoul(item.substr(colon + 1), &parsed);
+            if (parsed != item.size() - colon - 1) {
+                throw std::invalid_argument(item);
+            }
+        } catch (const std::exception&) {
+            return std::unexpected("Invalid weight of contract kind '" + name + "'");
+        }
+    }
+    if (std::accumulate(result.begin(), result.end(), std::size_t{0}) == 0) {
+        return std::unexpected<std::string>("Contract mix is empty");
+    }
+    return result;
+}
+
+std::expected<workload, std::string> generate_workload(const workload_options& options) {
+    if (options.contracts_per_kind == 0) {
+        return std::unexpected<std::string>("At least one contract of each kind is required");
+    }
+    const auto total_weight =
+        std::accumulate(options.contract_mix.begin(), options.contract_mix.end(), std::size_t{0});
+    if (total_weight == 0) {
+        return std::unexpected<std::string>("Contract mix is empty");
+    }
+    std::mt19937_64 rng(options.seed);
+
+    // Contracts of kind k are contracts[k * contracts_per_kind + i]
+    std::vector<core::types::Address> contracts;
+    boost::json::array accounts_json;
+    for (std::size_t kind = 0; kind < kWorkloadContractKinds; kind++) {
+        for (std::size_t i = 0; i < options.contracts_per_kind; i++) {
+            core::types::SmartContract contract{};
+            contract.m_address = make_address(rng);
+            contract.m_initialised = true;
+            contract.m_balance.m_value = 1000000000;
+            contracts.push_back(contract.m_address);
+
+            boost::json::array storage_json;
+            for (std::size_t slot = 0; slot < options.storage_slots; slot++) {
+                // Storage contract overwrites slots keyed by calldata offsets
+                storage_json.push_back(boost::json::object{
+                    {"Key", storage_key(slot * kWordSize)},
+                    {"Val", std::to_string(rng() % 1000000000 + 1)},
+                });
+            }
+            accounts_json.push_back(boost::json::object{
+                {"code", to_hex(kContractCode[kind])},
+                {"contract", to_hex(ssz::serialize(contract))},
+                {"proof", "0x00"},
+                {"storage", std::move(storage_json)},
+            });
+        }
+    }
+
+    workload result;
+    result.state =
+        boost::json::serialize(boost::json::object{{"accounts", std::move(accounts_json)}});
+
+    const auto sender = make_address(rng);
+    std::array<std::uint8_t, kWordSize> parent_hash{};
+    std::size_t seqno = 0;
+    for (std::size_t block = 0; block < options.blocks; block++) {
+        boost::json::array messages_json;
+        for (std::size_t i = 0; i < options.messages_per_block; i++) {
+            // Weighted choice of contract kind
+            auto choice = rng() % total_weight;
+            std::size_t kind = 0;
+            while (choice >= options.contract_mix[kind]) {
+                choice -= options.contract_mix[kind];
+                ++kind;
+            }
+            const auto& to = contracts[kind * options.contracts_per_kind +
+                                       rng() % options.contracts_per_kind];
+            std::ostringstream seqno_hex;
+            seqno_hex << "0x" << std::hex << seqno++;
+            messages_json.push_back(boost::json::object{
+                {"flags", boost::json::array{"Internal"}},
+                {"success", true},
+                {"data", to_hex(make_calldata(static_cast<workload_contract>(kind), options, rng))},
+                {"from", to_hex(sender)},
+                {"to", to_hex(to)},
+                {"refundTo", to_hex(sender)},
+                {"bounceTo", to_hex(sender)},
+                {"feeCredit", "10000000"},
+                {"value", "0"},
+                {"seqno", seqno_hex.str()},
+                {"index", i},
+                {"signature", "0x"},
+            });
+        }
+        result.messages += options.messages_per_block;
+        result.blocks.push_back(boost::json::serialize(boost::json::object{
+            {"number", block + 1},
+            {"parentHash", to_hex(parent_hash)},
+            {"shardId", kShardId},
+            {"gasPrice", "10"},
+            {"messages", std::move(messages_json)},
+        }));
+        parent_hash[kWordSize - 1] = static_cast<std::uint8_t>(block + 1);
+    }
+    return result;
+}
+
+std::optional<std::string> write_workload(const workload& generated,
+                                          const std::string& directory) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        return "Cannot create " + directory + ": " + ec.message();
+    }
+    auto write_file = [](const std::filesystem::path& path,
+                         const std::string& content) -> std::optional<std::string> {
+        std::ofstream out(path, std::ios_base::out);
+        if (!out.is_open()) {
+            return "Cannot open " + path.string();
+        }
+        out << content;
+        return {};
+    };
+    auto err = write_file(std::filesystem::path(directory) / "state.json", generated.state);
+    for (std::size_t i = 0; i < generated.blocks.size() && !err; i++) {
+        err = write_file(std::filesystem::path(directory) / ("block" + std::to_string(i) + ".json"),
+                         generated.blocks[i]);
+    }
+    return err;
+}
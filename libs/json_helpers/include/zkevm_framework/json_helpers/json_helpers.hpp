@@ -6,6 +6,7 @@
 #include <expected>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace json_helpers {
@@ -37,6 +38,11 @@ namespace json_helpers {
     std::optional<std::string> to_std_bytes(const boost::json::value &json_value,
                                             std::vector<std::byte> &dst) noexcept;
 
+    /// @brief Decode hex string directly into the end of the given vector std::bytes, without
+    /// intermediate copies
+    std::optional<std::string> append_std_bytes(std::string_view hex_string,
+                                                std::vector<std::byte> &dst) noexcept;
+
 }  // namespace json_helpers
 
 #endif  // ZKEMV_FRAMEWORK_LIBS_JSON_HELPERS_INCLUDE_ZKEVM_FRAMEWORK_JSON_HELPERS_JSON_HELPERS_HPP_
@@ -106,6 +106,41 @@ namespace json_helpers {
         return std::nullopt;
     }
 
+    std::optional<std::string> append_std_bytes(std::string_view hex_string,
+                                                std::vector<std::byte> &dst) noexcept {
+        // Skip 0x prefix if exists
+        if (hex_string.starts_with("0x")) {
+            hex_string.remove_prefix(2);
+        }
+        if (hex_string.size() % 2 != 0) {
+            return "Hex string to bytes failed";
+        }
+        auto nibble = [](char c) -> int {
+            if (c >= '0' && c <= '9') {
+                return c - '0';
+            }
+            if (c >= 'a' && c <= 'f') {
+                return c - 'a' + 10;
+            }
+            if (c >= 'A' && c <= 'F') {
+                return c - 'A' + 10;
+            }
+            return -1;
+        };
+        const auto old_size = dst.size();
+        dst.resize(old_size + hex_string.size() / 2);
+        for (std::size_t i = 0; i < hex_string.size(); i += 2) {
+            const int high = nibble(hex_string[i]);
+            const int low = nibble(hex_string[i + 1]);
+            if (high < 0 || low < 0) {
+                dst.resize(old_size);
+                return "Hex string to bytes failed";
+            }
+            dst[old_size + i / 2] = static_cast<std::byte>((high << 4) | low);
+        }
+        return std::nullopt;
+    }
+
     std::optional<std::string> to_std_bytes(const boost::json::value &json_value,
                                             std::vector<std::byte> &dst) noexcept {
         std::vector<uint8_t> bytes;
@@ -0,0 +1,35 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_HASH_TREE_ROOT_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_HASH_TREE_ROOT_HPP_
+
+#include <cstddef>
+#include <span>
+
+#include "zkevm_framework/core/common.hpp"
+#include "zkevm_framework/core/types/block.hpp"
+#include "zkevm_framework/core/types/message.hpp"
+#include "zkevm_framework/core/types/views.hpp"
+
+/**
+ * SSZ hash_tree_root of blocks and messages. SHA-256 of SSZ++ hashes chunks in batches with
+ * SHA-NI or AVX2 kernels where CPU supports them.
+ *
+ * Lists of messages are merkleized in parallel: roots of elements are computed by `threads`
+ * threads (0 means hardware concurrency), then the tree over them is built by SSZ++ with the same
+ * number of threads.
+ */
+namespace core {
+    /// @brief Limit of SSZ lists of messages of one block
+    constexpr std::size_t MAX_BLOCK_LIST_SIZE = 1 << 20;
+
+    Hash hash_tree_root(const types::Block& block);
+    Hash hash_tree_root(const types::Message& message);
+    /// @brief Same root as of the parsed message, computed without deserializing it
+    Hash hash_tree_root(const types::MessageView& message);
+
+    /// @brief Root of SSZ list with limit `MAX_BLOCK_LIST_SIZE`, given roots of its elements
+    Hash list_root(std::span<const Hash> element_roots, std::size_t threads = 0);
+
+    Hash messages_root(std::span<const types::Message> messages, std::size_t threads = 0);
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_HASH_TREE_ROOT_HPP_
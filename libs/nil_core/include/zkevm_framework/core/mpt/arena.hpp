@@ -0,0 +1,45 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_ARENA_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace core {
+    namespace mpt {
+
+        /// @brief Append-only byte storage. Bytes are copied into large chunks, so storing many
+        /// small encoded nodes costs one heap allocation per chunk instead of one per node.
+        /// Stored bytes stay at the same address until the arena is cleared or destroyed.
+        class ByteArena {
+          public:
+            static constexpr std::size_t kDefaultChunkSize = 64 * 1024;
+
+            explicit ByteArena(std::size_t chunk_size = kDefaultChunkSize);
+            ByteArena(const ByteArena&) = delete;
+            ByteArena& operator=(const ByteArena&) = delete;
+            ByteArena(ByteArena&&) = default;
+            ByteArena& operator=(ByteArena&&) = default;
+
+            /// @brief Copy bytes into the arena and return view of the stored copy.
+            std::span<const std::byte> store(std::span<const std::byte> bytes);
+
+            /// @brief Total size of allocated chunks.
+            std::size_t allocated_bytes() const;
+
+            void clear();
+
+          private:
+            std::vector<std::unique_ptr<std::byte[]>> chunks_;
+            // Buffers larger than a chunk, the last chunk stays the one being filled
+            std::vector<std::unique_ptr<std::byte[]>> oversized_;
+            std::size_t chunk_size_;
+            std::size_t chunk_used_ = 0;
+            std::size_t allocated_ = 0;
+        };
+
+    }  // namespace mpt
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_ARENA_HPP_
@@ -0,0 +1,125 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_FLAT_NODE_MAP_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_FLAT_NODE_MAP_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace core {
+    namespace mpt {
+
+        /// @brief Open-addressing hash map with linear probing.
+        ///
+        /// Keys and values are stored directly in one contiguous array of slots, capacity is
+        /// always a power of two. Elements are never erased one by one: trie nodes are
+        /// immutable and only added to the storage.
+        template<typename Key, typename Value, typename Hash = std::hash<Key>,
+                 typename KeyEqual = std::equal_to<Key>>
+        class FlatNodeMap {
+          public:
+            FlatNodeMap() = default;
+
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            std::size_t capacity() const { return slots_.size(); }
+
+            /// @brief Bytes occupied by the slot array (heap memory owned by values excluded).
+            std::size_t allocated_bytes() const { return slots_.capacity() * sizeof(Slot); }
+
+            const Value* find(const Key& key) const {
+                if (slots_.empty()) {
+                    return nullptr;
+                }
+                const std::size_t mask = slots_.size() - 1;
+                for (std::size_t idx = hash_(key) & mask;; idx = (idx + 1) & mask) {
+                    const auto& slot = slots_[idx];
+                    if (!slot.occupied) {
+                        return nullptr;
+                    }
+                    if (equal_(slot.key, key)) {
+                        return &slot.value;
+                    }
+                }
+            }
+
+            bool contains(const Key& key) const { return find(key) != nullptr; }
+
+            /// @brief Insert value or replace existing one. Returns true if key was not present.
+            bool insert_or_assign(const Key& key, Value value) {
+                if ((size_ + 1) * kMaxLoadDen > slots_.size() * kMaxLoadNum) {
+                    rehash(slots_.empty() ? kMinCapacity : slots_.size() * 2);
+                }
+                auto& slot = probe(key);
+                const bool inserted = !slot.occupied;
+                if (inserted) {
+                    slot.key = key;
+                    slot.occupied = true;
+                    ++size_;
+                }
+                slot.value = std::move(value);
+                return inserted;
+            }
+
+            /// @brief Make room for at least `count` elements without rehashing.
+            void reserve(std::size_t count) {
+                std::size_t required = std::bit_ceil((count * kMaxLoadDen + kMaxLoadNum - 1) /
+                                                     kMaxLoadNum);
+                if (required > slots_.size()) {
+                    rehash(std::max(required, kMinCapacity));
+                }
+            }
+
+            void clear() {
+                slots_.clear();
+                size_ = 0;
+            }
+
+          private:
+            struct Slot {
+                Key key{};
+                Value value{};
+                bool occupied = false;
+            };
+
+            static constexpr std::size_t kMinCapacity = 16;
+            // Maximum load factor is 3/4: linear probing degrades quickly above it
+            static constexpr std::size_t kMaxLoadNum = 3;
+            static constexpr std::size_t kMaxLoadDen = 4;
+
+            Slot& probe(const Key& key) {
+                const std::size_t mask = slots_.size() - 1;
+                for (std::size_t idx = hash_(key) & mask;; idx = (idx + 1) & mask) {
+                    auto& slot = slots_[idx];
+                    if (!slot.occupied || equal_(slot.key, key)) {
+                        return slot;
+                    }
+                }
+            }
+
+            void rehash(std::size_t new_capacity) {
+                std::vector<Slot> old_slots(new_capacity);
+                old_slots.swap(slots_);
+                for (auto& slot : old_slots) {
+                    if (slot.occupied) {
+                        auto& target = probe(slot.key);
+                        target.key = std::move(slot.key);
+                        target.value = std::move(slot.value);
+                        target.occupied = true;
+                    }
+                }
+            }
+
+            std::vector<Slot> slots_;
+            std::size_t size_ = 0;
+            [[no_unique_address]] Hash hash_;
+            [[no_unique_address]] KeyEqual equal_;
+        };
+
+    }  // namespace mpt
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_FLAT_NODE_MAP_HPP_
@@ -0,0 +1,77 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_HASHER_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_HASHER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+#include "zkevm_framework/core/mpt/node_key.hpp"
+
+namespace core {
+    namespace mpt {
+
+        /// @brief Hash function used by the trie for node references and for keys longer than
+        /// 32 bytes. Implementations must be thread safe: batches may be hashed concurrently.
+        class NodeHasher {
+          public:
+            virtual ~NodeHasher() = default;
+
+            /// @brief Size of produced digest. Must be in [32, NodeKey::kMaxSize]: shorter
+            /// references are treated as inlined nodes.
+            virtual std::size_t digest_size() const = 0;
+
+            virtual NodeKey Hash(std::span<const std::byte> data) const = 0;
+
+            /// @brief Hash many independent inputs at once, `outputs` must have the same size as
+            /// `inputs`. Default implementation hashes inputs one by one, override it to use
+            /// vectorized or multi-buffer implementation.
+            virtual void HashBatch(std::span<const std::span<const std::byte>> inputs,
+                                   std::span<NodeKey> outputs) const;
+        };
+
+        /// @brief Dummy 64-byte hash. Cheap, but not collision resistant: use for testing only.
+        class BasicHasher : public NodeHasher {
+          public:
+            std::size_t digest_size() const override { return 64; }
+            NodeKey Hash(std::span<const std::byte> data) const override;
+        };
+
+        /// @brief Keccak-256 as used by Ethereum (original padding, not SHA3-256).
+        class Keccak256Hasher : public NodeHasher {
+          public:
+            std::size_t digest_size() const override { return 32; }
+            NodeKey Hash(std::span<const std::byte> data) const override;
+        };
+
+        /// @brief Splits batches of another hasher between threads. Nodes of one trie height are
+        /// independent, so bulk building of large tries hashes each height in parallel. Batches
+        /// smaller than `min_batch` are hashed by the calling thread.
+        class ParallelHasher : public NodeHasher {
+          public:
+            static constexpr std::size_t kDefaultMinBatch = 256;
+
+            /// @param threads number of threads hashing a batch, 0 means hardware concurrency
+            explicit ParallelHasher(std::shared_ptr<const NodeHasher> inner,
+                                    std::size_t threads = 0,
+                                    std::size_t min_batch = kDefaultMinBatch);
+
+            std::size_t digest_size() const override { return inner_->digest_size(); }
+            NodeKey Hash(std::span<const std::byte> data) const override {
+                return inner_->Hash(data);
+            }
+            void HashBatch(std::span<const std::span<const std::byte>> inputs,
+                           std::span<NodeKey> outputs) const override;
+
+          private:
+            std::shared_ptr<const NodeHasher> inner_;
+            std::size_t threads_;
+            std::size_t min_batch_;
+        };
+
+        /// @brief Hasher used by tries constructed without explicit hasher.
+        std::shared_ptr<const NodeHasher> DefaultHasher();
+
+    }  // namespace mpt
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_HASHER_HPP_
@@ -3,22 +3,17 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <memory>
-#include <unordered_map>
+#include <optional>
+#include <utility>
 #include <vector>
 
+#include "zkevm_framework/core/mpt/arena.hpp"
+#include "zkevm_framework/core/mpt/flat_node_map.hpp"
+#include "zkevm_framework/core/mpt/hasher.hpp"
 #include "zkevm_framework/core/mpt/node.hpp"
-
-namespace std {
-    // To allow using vector of bytes as key in unordered_map
-    template<>
-    struct hash<vector<byte>> {
-        size_t operator()(const vector<byte>& v) const {
-            return hash<string_view>()(
-                string_view(reinterpret_cast<const char*>(v.data()), v.size()));
-        }
-    };
-}  // namespace std
+#include "zkevm_framework/core/mpt/node_key.hpp"
 
 namespace core {
     namespace mpt {
@@ -28,18 +23,50 @@ namespace core {
             class SetHandler;
             class DeleteHandler;
             struct DeleteResult;
+            class BulkBuilder;
         }  // namespace details
 
+        /// @brief Source of encoded nodes missing in the trie storage, e.g. remote database.
+        /// Returns std::nullopt if node is unknown.
+        using NodeLoader = std::function<std::optional<Bytes>(const Reference& ref)>;
+
         class MerklePatriciaTrie {
           public:
-            MerklePatriciaTrie();
+            explicit MerklePatriciaTrie(std::shared_ptr<const NodeHasher> hasher = DefaultHasher());
+
+            /// @brief Open existing trie with given root. Nodes are requested from `loader` on
+            /// first access and checked against their references, so only touched paths are
+            /// ever loaded. Lazy loading mutates the storage: such trie must not be read
+            /// concurrently.
+            MerklePatriciaTrie(Reference root, NodeLoader loader,
+                               std::shared_ptr<const NodeHasher> hasher = DefaultHasher());
+
             std::vector<std::byte> get(const std::vector<std::byte>& key) const;
+            /// @brief Same as `get`, but returns std::nullopt for missing key instead of throwing.
+            std::optional<std::vector<std::byte>> find(const std::vector<std::byte>& key) const;
             void set(const std::vector<std::byte>& key, const std::vector<std::byte>& value);
             void remove(const std::vector<std::byte>& key);
 
+            /// @brief Replace trie contents with given entries. For duplicated keys the last
+            /// value wins, as with sequential `set`.
+            ///
+            /// Trie is built bottom-up in a single pass: all nodes of the same height are
+            /// encoded first and hashed with one `NodeHasher::HashBatch` call. Resulting root is
+            /// the same as after inserting entries one by one.
+            void build(
+                std::vector<std::pair<std::vector<std::byte>, std::vector<std::byte>>> entries);
+
+            /// @brief Reference to the root node, empty for empty trie.
+            const Reference& root() const { return root_; }
+            const NodeHasher& hasher() const { return *hasher_; }
+
+            /// @brief Encoded node stored under given reference (not consulting the loader), can
+            /// be used as `NodeLoader` of another trie.
+            std::optional<Bytes> find_node(const Reference& ref) const;
+
           protected:
             Node GetFromStorage(const Reference& ref) const;
-            Reference PutToStorage(const Node& node);
+            Reference PutToStorage(const Serializable& node);
             std::optional<std::vector<std::byte>> GetNode(const Reference& nodeRef,
                                                           Path& path) const;
             Reference SetNode(const Reference& nodeRef, Path& path,
@@ -47,16 +74,23 @@ namespace core {
             details::DeleteResult DeleteNode(const Reference& nodeRef, const Path& path);
 
           private:
-            static Path PathFromKey(const std::vector<std::byte>& key);
+            std::vector<std::byte> KeyBytes(const std::vector<std::byte>& key) const;
+            Path PathFromKey(const std::vector<std::byte>& key) const;
             static constexpr size_t kMaxRawKeyLen = 32;
 
+            std::shared_ptr<const NodeHasher> hasher_;
+            NodeLoader loader_;
             Reference root_;
-            std::unordered_map<Reference, std::vector<std::byte>>
-                nodes_;  // Better design is to use other external class for storage
+            // Storage is filled from loader_ on lookup misses, hence mutable
+            mutable FlatNodeMap<NodeKey, std::span<const std::byte>, NodeKeyHash>
+                nodes_;                // Better design is to use other external class for storage
+            mutable ByteArena arena_;  // Owns encoded nodes referenced by nodes_
+            Bytes encode_buffer_;      // Scratch buffer reused by PutToStorage
 
             friend class details::GetHandler;
             friend class details::SetHandler;
             friend class details::DeleteHandler;
+            friend class details::BulkBuilder;
         };
 
     }  // namespace mpt
@@ -2,6 +2,7 @@
 #define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_HPP_
 
 #include <cstdint>
+#include <span>
 #include <ssz++.hpp>
 #include <vector>
 
@@ -24,7 +25,16 @@ namespace core {
         class Serializable {
           public:
             virtual ~Serializable() = default;
-            virtual Bytes Encode() const = 0;
+
+            /// @brief Encode into caller-supplied buffer. Buffer is overwritten, but its capacity
+            /// is reused, so encoding many nodes through one scratch buffer doesn't allocate.
+            virtual void EncodeTo(Bytes& buffer) const = 0;
+
+            Bytes Encode() const {
+                Bytes encoded;
+                EncodeTo(encoded);
+                return encoded;
+            }
         };
 
         class NodeBase : public ssz::ssz_variable_size_container, public Serializable {};
@@ -54,7 +64,7 @@ namespace core {
             LeafNode() = default;
             LeafNode(const Path& path, const std::vector<std::byte>& new_value);
 
-            Bytes Encode() const override;
+            void EncodeTo(Bytes& buffer) const override;
 
             SSZ_CONT(path, value_)
         };
@@ -64,7 +74,7 @@ namespace core {
             ExtensionNode() = default;
             ExtensionNode(const Path& path, const Reference& next);
 
-            Bytes Encode() const override;
+            void EncodeTo(Bytes& buffer) const override;
             const Reference& get_next_ref() const;
 
             SSZ_CONT(path, next_ref_)
@@ -79,8 +89,11 @@ namespace core {
             BranchNode(const std::array<Reference, kBranchesNum>& refs,
                        const std::vector<std::byte>& value);
 
-            Bytes Encode() const override;
+            void EncodeTo(Bytes& buffer) const override;
             std::array<Reference, kBranchesNum> get_branches() const;
+            // Reference to the child stored in the node, no copy is made
+            const Reference& get_branch(std::byte nibble) const;
+            std::size_t CountBranches() const;
             void ClearBranch(std::byte nibble);
             void SetBranch(std::byte nibble, const std::vector<std::byte>& value);
 
@@ -92,6 +105,7 @@ namespace core {
 
         using Node = std::variant<LeafNode, ExtensionNode, BranchNode>;
 
+        Node DecodeNode(std::span<const std::byte> bytes);
         Node DecodeNode(const Bytes& bytes);
 
     }  // namespace mpt
@@ -0,0 +1,66 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_KEY_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_KEY_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace core {
+    namespace mpt {
+
+        /// @brief Key of a node in the trie storage: digest of the encoded node.
+        ///
+        /// Digest is stored inline, so keys don't allocate and can be kept directly in the
+        /// slots of a flat hash map.
+        class NodeKey {
+          public:
+            static constexpr std::size_t kMaxSize = 64;
+
+            NodeKey() = default;
+
+            explicit NodeKey(std::span<const std::byte> digest) : size_(digest.size()) {
+                if (digest.size() > kMaxSize) {
+                    throw std::length_error("Node key digest is too long");
+                }
+                std::copy(digest.begin(), digest.end(), data_.begin());
+            }
+
+            std::span<const std::byte> bytes() const { return {data_.data(), size_}; }
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+
+            std::vector<std::byte> to_vector() const {
+                return std::vector<std::byte>(data_.begin(), data_.begin() + size_);
+            }
+
+            bool operator==(const NodeKey& other) const {
+                return size_ == other.size_ &&
+                       std::equal(data_.begin(), data_.begin() + size_, other.data_.begin());
+            }
+
+          private:
+            std::array<std::byte, kMaxSize> data_{};
+            std::uint8_t size_ = 0;
+        };
+
+        /// @brief Hasher for node keys.
+        ///
+        /// Node keys are outputs of the node hash function and are uniformly distributed
+        /// already, so the first 8 bytes of the digest are used as is.
+        struct NodeKeyHash {
+            std::size_t operator()(const NodeKey& key) const noexcept {
+                std::uint64_t prefix = 0;
+                std::memcpy(&prefix, key.bytes().data(), std::min(key.size(), sizeof(prefix)));
+                return static_cast<std::size_t>(prefix);
+            }
+        };
+
+    }  // namespace mpt
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_KEY_HPP_
@@ -0,0 +1,37 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_PARALLEL_FOR_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_PARALLEL_FOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace core {
+    /**
+     * @brief Call `process(i)` for every `i` in [0, count) from `threads` threads, 0 means
+     * hardware concurrency. Every thread processes a contiguous range of indices, the calling
+     * thread takes the last one. Calls for different indices must be independent.
+     */
+    template<typename Process>
+    void parallel_for(std::size_t count, std::size_t threads, Process&& process) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        threads = std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(count, 1));
+        const std::size_t per_thread = (count + threads - 1) / threads;
+        auto process_range = [&process](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                process(i);
+            }
+        };
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        std::size_t begin = 0;
+        for (; begin + per_thread < count; begin += per_thread) {
+            workers.emplace_back(process_range, begin, begin + per_thread);
+        }
+        process_range(begin, count);
+    }
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_PARALLEL_FOR_HPP_
@@ -3,6 +3,7 @@
 
 #include <bitset>
 #include <cstdint>
+#include <span>
 
 #include "zkevm_framework/core/types/address.hpp"
 #include "zkevm_framework/core/types/code.hpp"
@@ -42,6 +43,16 @@ namespace core {
 
             SSZ_CONT(m_flags, m_chain_id, m_seqno, m_feeCredit, m_from, m_to, m_refund_to,
                      m_bounce_to, m_value, m_currency, m_data, m_signature)
+
+            // Same accessors as `MessageView` has, so parsed and serialized messages are
+            // consumed by the same code
+            const std::bitset<8>& flags() const { return m_flags; }
+            Seqno seqno() const { return m_seqno; }
+            const Value& fee_credit() const { return m_feeCredit; }
+            const Address& from() const { return m_from; }
+            const Address& to() const { return m_to; }
+            const Value& value() const { return m_value; }
+            std::span<const std::byte> data() const { return m_data.data(); }
         };
 
         using MessageStatus = std::uint32_t;
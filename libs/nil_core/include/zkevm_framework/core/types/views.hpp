@@ -0,0 +1,256 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_TYPES_VIEWS_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_TYPES_VIEWS_HPP_
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "intx/intx.hpp"
+#include "ssz++.hpp"
+#include "zkevm_framework/core/common.hpp"
+#include "zkevm_framework/core/types/account.hpp"
+#include "zkevm_framework/core/types/block.hpp"
+#include "zkevm_framework/core/types/message.hpp"
+
+/**
+ * Read-only views over SSZ serialized objects. Views don't own the bytes and don't copy them,
+ * variable size fields are returned as spans. Views are validated once on parsing, so accessors
+ * don't check bounds.
+ */
+namespace core {
+    namespace types {
+        namespace detail {
+            constexpr std::size_t OFFSET_SIZE = 4;
+            constexpr std::size_t UINT256_SIZE = 32;
+
+            inline std::uint32_t load_offset(const std::byte* data) {
+                std::uint32_t result = 0;
+                for (std::size_t i = 0; i < OFFSET_SIZE; i++) {
+                    result |= std::to_integer<std::uint32_t>(data[i]) << (8 * i);
+                }
+                return result;
+            }
+
+            inline std::uint64_t load_uint64(const std::byte* data) {
+                std::uint64_t result = 0;
+                for (std::size_t i = 0; i < sizeof(std::uint64_t); i++) {
+                    result |= std::to_integer<std::uint64_t>(data[i]) << (8 * i);
+                }
+                return result;
+            }
+
+            inline Value load_value(const std::byte* data) {
+                return Value{.m_value = intx::le::unsafe::load<intx::uint256>(
+                                 reinterpret_cast<const std::uint8_t*>(data))};
+            }
+
+            template<typename Array>
+            Array load_array(const std::byte* data) {
+                Array result;
+                std::copy_n(data, result.size(), result.begin());
+                return result;
+            }
+        }  // namespace detail
+
+        /// @brief View over serialized `Message`
+        class MessageView {
+          public:
+            // Offsets of fields in the fixed size part
+            static constexpr std::size_t FLAGS = 0;
+            static constexpr std::size_t CHAIN_ID = FLAGS + 1;
+            static constexpr std::size_t SEQNO = CHAIN_ID + sizeof(ChainId);
+            static constexpr std::size_t FEE_CREDIT = SEQNO + sizeof(Seqno);
+            static constexpr std::size_t FROM = FEE_CREDIT + detail::UINT256_SIZE;
+            static constexpr std::size_t TO = FROM + ADDR_SIZE;
+            static constexpr std::size_t REFUND_TO = TO + ADDR_SIZE;
+            static constexpr std::size_t BOUNCE_TO = REFUND_TO + ADDR_SIZE;
+            static constexpr std::size_t VALUE = BOUNCE_TO + ADDR_SIZE;
+            static constexpr std::size_t CURRENCY_OFFSET = VALUE + detail::UINT256_SIZE;
+            static constexpr std::size_t DATA_OFFSET = CURRENCY_OFFSET + detail::OFFSET_SIZE;
+            static constexpr std::size_t SIGNATURE_OFFSET = DATA_OFFSET + detail::OFFSET_SIZE;
+            static constexpr std::size_t FIXED_SIZE = SIGNATURE_OFFSET + detail::OFFSET_SIZE;
+            static constexpr std::size_t CURRENCY_BALANCE_SIZE = HASH_SIZE + detail::UINT256_SIZE;
+            // Size limits of lists, same as in `Message`
+            static constexpr std::size_t MAX_CURRENCIES = 256;
+            static constexpr std::size_t MAX_DATA_SIZE = 24576;
+            static constexpr std::size_t MAX_SIGNATURE_SIZE = 256;
+
+            MessageView() = default;
+
+            /// @brief Check offsets of variable size fields, std::nullopt for malformed bytes
+            static std::optional<MessageView> parse(std::span<const std::byte> bytes) {
+                if (bytes.size() < FIXED_SIZE) {
+                    return std::nullopt;
+                }
+                const std::size_t currency = detail::load_offset(&bytes[CURRENCY_OFFSET]);
+                const std::size_t data = detail::load_offset(&bytes[DATA_OFFSET]);
+                const std::size_t signature = detail::load_offset(&bytes[SIGNATURE_OFFSET]);
+                if (currency != FIXED_SIZE || data < currency || signature < data ||
+                    signature > bytes.size() ||
+                    (data - currency) % CURRENCY_BALANCE_SIZE != 0 ||
+                    (data - currency) / CURRENCY_BALANCE_SIZE > MAX_CURRENCIES ||
+                    signature - data > MAX_DATA_SIZE ||
+                    bytes.size() - signature > MAX_SIGNATURE_SIZE) {
+                    return std::nullopt;
+                }
+                MessageView view;
+                view.m_bytes = bytes;
+                view.m_data_begin = data;
+                view.m_signature_begin = signature;
+                return view;
+            }
+
+            std::bitset<8> flags() const {
+                return std::bitset<8>(std::to_integer<unsigned long>(m_bytes[FLAGS]));
+            }
+            ChainId chain_id() const { return detail::load_uint64(&m_bytes[CHAIN_ID]); }
+            Seqno seqno() const { return detail::load_uint64(&m_bytes[SEQNO]); }
+            Value fee_credit() const { return detail::load_value(&m_bytes[FEE_CREDIT]); }
+            Address from() const { return detail::load_array<Address>(&m_bytes[FROM]); }
+            Address to() const { return detail::load_array<Address>(&m_bytes[TO]); }
+            Address refund_to() const { return detail::load_array<Address>(&m_bytes[REFUND_TO]); }
+            Address bounce_to() const { return detail::load_array<Address>(&m_bytes[BOUNCE_TO]); }
+            Value value() const { return detail::load_value(&m_bytes[VALUE]); }
+
+            /// @brief Serialized `CurrencyBalance` items
+            std::span<const std::byte> currency() const {
+                return m_bytes.subspan(FIXED_SIZE, m_data_begin - FIXED_SIZE);
+            }
+            std::size_t currency_count() const {
+                return (m_data_begin - FIXED_SIZE) / CURRENCY_BALANCE_SIZE;
+            }
+            std::span<const std::byte> data() const {
+                return m_bytes.subspan(m_data_begin, m_signature_begin - m_data_begin);
+            }
+            std::span<const std::byte> signature() const {
+                return m_bytes.subspan(m_signature_begin);
+            }
+
+            std::span<const std::byte> bytes() const { return m_bytes; }
+
+            /// @brief Owning copy of the message
+            Message to_message() const { return ssz::deserialize<Message>(m_bytes); }
+
+          private:
+            std::span<const std::byte> m_bytes;
+            std::size_t m_data_begin = 0;
+            std::size_t m_signature_begin = 0;
+        };
+
+        /// @brief View over serialized `Block`
+        class BlockView {
+          public:
+            static constexpr std::size_t ID = 0;
+            static constexpr std::size_t PREV_BLOCK = ID + sizeof(BlockNumber);
+            static constexpr std::size_t SMART_CONTRACTS_ROOT = PREV_BLOCK + HASH_SIZE;
+            static constexpr std::size_t IN_MESSAGES_ROOT = SMART_CONTRACTS_ROOT + HASH_SIZE;
+            static constexpr std::size_t OUT_MESSAGES_ROOT = IN_MESSAGES_ROOT + HASH_SIZE;
+            static constexpr std::size_t OUT_MESSAGES_NUM = OUT_MESSAGES_ROOT + HASH_SIZE;
+            static constexpr std::size_t RECEIPTS_ROOT = OUT_MESSAGES_NUM + sizeof(MessageIndex);
+            static constexpr std::size_t CHILD_BLOCKS_ROOT_HASH = RECEIPTS_ROOT + HASH_SIZE;
+            static constexpr std::size_t MASTER_CHAIN_HASH = CHILD_BLOCKS_ROOT_HASH + HASH_SIZE;
+            static constexpr std::size_t LOGS_BLOOM = MASTER_CHAIN_HASH + HASH_SIZE;
+            static constexpr std::size_t TIMESTAMP = LOGS_BLOOM + BLOOM_BYTE_LENGTH;
+            static constexpr std::size_t GAS_PRICE = TIMESTAMP + sizeof(std::uint64_t);
+            static constexpr std::size_t SIZE = GAS_PRICE + detail::UINT256_SIZE;
+
+            BlockView() = default;
+
+            static std::optional<BlockView> parse(std::span<const std::byte> bytes) {
+                if (bytes.size() != SIZE) {
+                    return std::nullopt;
+                }
+                BlockView view;
+                view.m_bytes = bytes;
+                return view;
+            }
+
+            BlockNumber id() const { return detail::load_uint64(&m_bytes[ID]); }
+            Hash prev_block() const { return detail::load_array<Hash>(&m_bytes[PREV_BLOCK]); }
+            Hash smart_contracts_root() const {
+                return detail::load_array<Hash>(&m_bytes[SMART_CONTRACTS_ROOT]);
+            }
+            Hash in_messages_root() const {
+                return detail::load_array<Hash>(&m_bytes[IN_MESSAGES_ROOT]);
+            }
+            Hash out_messages_root() const {
+                return detail::load_array<Hash>(&m_bytes[OUT_MESSAGES_ROOT]);
+            }
+            MessageIndex out_messages_num() const {
+                return detail::load_uint64(&m_bytes[OUT_MESSAGES_NUM]);
+            }
+            Hash receipts_root() const { return detail::load_array<Hash>(&m_bytes[RECEIPTS_ROOT]); }
+            Hash child_blocks_root_hash() const {
+                return detail::load_array<Hash>(&m_bytes[CHILD_BLOCKS_ROOT_HASH]);
+            }
+            Hash master_chain_hash() const {
+                return detail::load_array<Hash>(&m_bytes[MASTER_CHAIN_HASH]);
+            }
+            std::span<const std::byte, BLOOM_BYTE_LENGTH> logs_bloom() const {
+                return m_bytes.subspan<LOGS_BLOOM, BLOOM_BYTE_LENGTH>();
+            }
+            std::uint64_t timestamp() const { return detail::load_uint64(&m_bytes[TIMESTAMP]); }
+            Value gas_price() const { return detail::load_value(&m_bytes[GAS_PRICE]); }
+
+            std::span<const std::byte> bytes() const { return m_bytes; }
+
+            /// @brief Owning copy of the block, all fields have fixed size so nothing is allocated
+            Block to_block() const { return ssz::deserialize<Block>(m_bytes); }
+
+          private:
+            std::span<const std::byte> m_bytes;
+        };
+
+        /// @brief View over serialized `SmartContract`
+        class SmartContractView {
+          public:
+            static constexpr std::size_t ADDRESS = 0;
+            static constexpr std::size_t INITIALISED = ADDRESS + ADDR_SIZE;
+            static constexpr std::size_t BALANCE = INITIALISED + 1;
+            static constexpr std::size_t CURRENCY_ROOT = BALANCE + detail::UINT256_SIZE;
+            static constexpr std::size_t STORAGE_ROOT = CURRENCY_ROOT + HASH_SIZE;
+            static constexpr std::size_t CODE_HASH = STORAGE_ROOT + HASH_SIZE;
+            static constexpr std::size_t SEQNO = CODE_HASH + HASH_SIZE;
+            static constexpr std::size_t EXT_SEQNO = SEQNO + sizeof(Seqno);
+            static constexpr std::size_t PUBLIC_KEY = EXT_SEQNO + sizeof(Seqno);
+            static constexpr std::size_t SIZE = PUBLIC_KEY + PUBLIC_KEY_SIZE;
+
+            SmartContractView() = default;
+
+            static std::optional<SmartContractView> parse(std::span<const std::byte> bytes) {
+                if (bytes.size() != SIZE || std::to_integer<int>(bytes[INITIALISED]) > 1) {
+                    return std::nullopt;
+                }
+                SmartContractView view;
+                view.m_bytes = bytes;
+                return view;
+            }
+
+            Address address() const { return detail::load_array<Address>(&m_bytes[ADDRESS]); }
+            bool initialised() const { return m_bytes[INITIALISED] != std::byte{0}; }
+            Value balance() const { return detail::load_value(&m_bytes[BALANCE]); }
+            Hash currency_root() const { return detail::load_array<Hash>(&m_bytes[CURRENCY_ROOT]); }
+            Hash storage_root() const { return detail::load_array<Hash>(&m_bytes[STORAGE_ROOT]); }
+            Hash code_hash() const { return detail::load_array<Hash>(&m_bytes[CODE_HASH]); }
+            Seqno seqno() const { return detail::load_uint64(&m_bytes[SEQNO]); }
+            Seqno ext_seqno() const { return detail::load_uint64(&m_bytes[EXT_SEQNO]); }
+            std::span<const std::byte, PUBLIC_KEY_SIZE> public_key() const {
+                return m_bytes.subspan<PUBLIC_KEY, PUBLIC_KEY_SIZE>();
+            }
+
+            std::span<const std::byte> bytes() const { return m_bytes; }
+
+            SmartContract to_smart_contract() const {
+                return ssz::deserialize<SmartContract>(m_bytes);
+            }
+
+          private:
+            std::span<const std::byte> m_bytes;
+        };
+    }  // namespace types
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_TYPES_VIEWS_HPP_
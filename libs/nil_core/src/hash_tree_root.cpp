@@ -0,0 +1,139 @@
+#include "zkevm_framework/core/hash_tree_root.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ssz++.hpp"
+#include "zkevm_framework/core/parallel_for.hpp"
+
+namespace core {
+    namespace {
+        std::size_t resolve_threads(std::size_t threads) {
+            if (threads == 0) {
+                threads = std::thread::hardware_concurrency();
+            }
+            return std::max<std::size_t>(threads, 1);
+        }
+
+        template<typename T>
+        Hash ssz_root(const T& object, std::size_t threads = 1) {
+            const auto root = ssz::hash_tree_root(object, threads);
+            Hash result;
+            std::ranges::copy(root, result.begin());
+            return result;
+        }
+
+        // SHA-256 of two concatenated chunks, which is the root of SSZ vector of 64 bytes
+        Hash hash_pair(const Hash& left, const Hash& right) {
+            std::array<std::byte, 2 * HASH_SIZE> pair;
+            std::ranges::copy(left, pair.begin());
+            std::ranges::copy(right, pair.begin() + HASH_SIZE);
+            return ssz_root(pair);
+        }
+
+        // Bytes padded with zeros, the root of a basic value or of a vector of up to 32 bytes
+        Hash chunk(std::span<const std::byte> bytes) {
+            Hash result{};
+            std::ranges::copy(bytes, result.begin());
+            return result;
+        }
+
+        // SSZ merkleize: chunks are padded with zero chunks up to the power of two not less than
+        // `limit` and hashed pairwise level by level
+        Hash merkleize(std::vector<Hash> chunks, std::size_t limit) {
+            Hash zero{};
+            for (std::size_t width = 1; width < limit; width *= 2) {
+                if (chunks.size() % 2 == 1) {
+                    chunks.push_back(zero);
+                }
+                for (std::size_t i = 0; i < chunks.size(); i += 2) {
+                    chunks[i / 2] = hash_pair(chunks[i], chunks[i + 1]);
+                }
+                chunks.resize(chunks.size() / 2);
+                zero = hash_pair(zero, zero);
+            }
+            return chunks.empty() ? zero : chunks.front();
+        }
+
+        Hash mix_in_length(const Hash& root, std::size_t length) {
+            Hash encoded{};
+            for (std::size_t i = 0; i < sizeof(std::uint64_t); i++) {
+                encoded[i] = static_cast<std::byte>(static_cast<std::uint64_t>(length) >> (8 * i));
+            }
+            return hash_pair(root, encoded);
+        }
+
+        // Root of SSZ list of bytes with limit `max_size`
+        Hash bytes_root(std::span<const std::byte> bytes, std::size_t max_size) {
+            std::vector<Hash> chunks((bytes.size() + HASH_SIZE - 1) / HASH_SIZE);
+            for (std::size_t i = 0; i < chunks.size(); i++) {
+                const std::size_t begin = i * HASH_SIZE;
+                chunks[i] = chunk(bytes.subspan(begin, std::min(HASH_SIZE, bytes.size() - begin)));
+            }
+            const std::size_t limit = (max_size + HASH_SIZE - 1) / HASH_SIZE;
+            return mix_in_length(merkleize(std::move(chunks), limit), bytes.size());
+        }
+    }  // namespace
+
+    Hash hash_tree_root(const types::Block& block) { return ssz_root(block); }
+
+    Hash hash_tree_root(const types::Message& message) { return ssz_root(message); }
+
+    // Merkleized right from the serialized bytes, deserializing the message would copy its
+    // variable size fields
+    Hash hash_tree_root(const types::MessageView& message) {
+        using View = types::MessageView;
+        const auto bytes = message.bytes();
+        // Fixed size fields take one chunk each
+        auto fixed = [&bytes](std::size_t begin, std::size_t end) {
+            return chunk(bytes.subspan(begin, end - begin));
+        };
+        // Currency id and balance are 32 bytes each, so a balance is hashed as two chunks
+        std::vector<Hash> currency(message.currency_count());
+        for (std::size_t i = 0; i < currency.size(); i++) {
+            const auto balance = message.currency().subspan(i * View::CURRENCY_BALANCE_SIZE,
+                                                            View::CURRENCY_BALANCE_SIZE);
+            currency[i] = hash_pair(chunk(balance.first(HASH_SIZE)),
+                                    chunk(balance.subspan(HASH_SIZE)));
+        }
+        std::vector<Hash> fields = {
+            fixed(View::FLAGS, View::CHAIN_ID),
+            fixed(View::CHAIN_ID, View::SEQNO),
+            fixed(View::SEQNO, View::FEE_CREDIT),
+            fixed(View::FEE_CREDIT, View::FROM),
+            fixed(View::FROM, View::TO),
+            fixed(View::TO, View::REFUND_TO),
+            fixed(View::REFUND_TO, View::BOUNCE_TO),
+            fixed(View::BOUNCE_TO, View::VALUE),
+            fixed(View::VALUE, View::CURRENCY_OFFSET),
+            mix_in_length(merkleize(std::move(currency), View::MAX_CURRENCIES),
+                          message.currency_count()),
+            bytes_root(message.data(), View::MAX_DATA_SIZE),
+            bytes_root(message.signature(), View::MAX_SIGNATURE_SIZE),
+        };
+        const auto limit = fields.size();
+        return merkleize(std::move(fields), limit);
+    }
+
+    Hash list_root(std::span<const Hash> element_roots, std::size_t threads) {
+        if (element_roots.size() > MAX_BLOCK_LIST_SIZE) {
+            throw std::length_error("List exceeds limit of SSZ list of a block");
+        }
+        // Root of a list of containers is the root of the list of their roots: each root takes
+        // exactly one chunk
+        ssz::list<Hash, MAX_BLOCK_LIST_SIZE> roots;
+        roots.data().assign(element_roots.begin(), element_roots.end());
+        return ssz_root(roots, resolve_threads(threads));
+    }
+
+    Hash messages_root(std::span<const types::Message> messages, std::size_t threads) {
+        std::vector<Hash> roots(messages.size());
+        parallel_for(messages.size(), threads,
+                     [&](std::size_t i) { roots[i] = hash_tree_root(messages[i]); });
+        return list_root(roots, threads);
+    }
+}  // namespace core
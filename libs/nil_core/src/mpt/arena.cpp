@@ -0,0 +1,41 @@
+#include "zkevm_framework/core/mpt/arena.hpp"
+
+#include <algorithm>
+
+namespace core {
+    namespace mpt {
+
+        ByteArena::ByteArena(std::size_t chunk_size) : chunk_size_(chunk_size) {}
+
+        std::span<const std::byte> ByteArena::store(std::span<const std::byte> bytes) {
+            if (bytes.size() > chunk_size_) {
+                // Oversized buffer gets its own allocation kept apart from chunks, so free space
+                // left in the current chunk can still be used
+                auto& buffer =
+                    oversized_.emplace_back(std::make_unique<std::byte[]>(bytes.size()));
+                std::copy(bytes.begin(), bytes.end(), buffer.get());
+                allocated_ += bytes.size();
+                return {buffer.get(), bytes.size()};
+            }
+            if (chunks_.empty() || chunk_used_ + bytes.size() > chunk_size_) {
+                chunks_.push_back(std::make_unique<std::byte[]>(chunk_size_));
+                allocated_ += chunk_size_;
+                chunk_used_ = 0;
+            }
+            std::byte* dst = chunks_.back().get() + chunk_used_;
+            std::copy(bytes.begin(), bytes.end(), dst);
+            chunk_used_ += bytes.size();
+            return {dst, bytes.size()};
+        }
+
+        std::size_t ByteArena::allocated_bytes() const { return allocated_; }
+
+        void ByteArena::clear() {
+            chunks_.clear();
+            oversized_.clear();
+            chunk_used_ = 0;
+            allocated_ = 0;
+        }
+
+    }  // namespace mpt
+}  // namespace core
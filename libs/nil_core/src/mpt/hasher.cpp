@@ -0,0 +1,173 @@
+#include "zkevm_framework/core/mpt/hasher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace core {
+    namespace mpt {
+
+        namespace {
+            constexpr std::array<std::uint64_t, 24> kKeccakRoundConstants = {
+                0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+                0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+                0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+                0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+                0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+                0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+                0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+                0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+            // Rotation offsets and lane permutation of rho and pi steps
+            constexpr std::array<int, 24> kKeccakRotations = {1,  3,  6,  10, 15, 21, 28, 36,
+                                                              45, 55, 2,  14, 27, 41, 56, 8,
+                                                              25, 43, 62, 18, 39, 61, 20, 44};
+            constexpr std::array<int, 24> kKeccakPiLanes = {10, 7,  11, 17, 18, 3,  5,  16,
+                                                            8,  21, 24, 4,  15, 23, 19, 13,
+                                                            12, 2,  20, 14, 22, 9,  6,  1};
+
+            void KeccakF1600(std::array<std::uint64_t, 25>& state) {
+                for (const auto round_constant : kKeccakRoundConstants) {
+                    // Theta
+                    std::array<std::uint64_t, 5> column;
+                    for (int x = 0; x < 5; ++x) {
+                        column[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^
+                                    state[x + 20];
+                    }
+                    for (int x = 0; x < 5; ++x) {
+                        const auto d = column[(x + 4) % 5] ^ std::rotl(column[(x + 1) % 5], 1);
+                        for (int y = 0; y < 25; y += 5) {
+                            state[y + x] ^= d;
+                        }
+                    }
+                    // Rho and pi
+                    auto current = state[1];
+                    for (int i = 0; i < 24; ++i) {
+                        const auto lane = kKeccakPiLanes[i];
+                        const auto next = state[lane];
+                        state[lane] = std::rotl(current, kKeccakRotations[i]);
+                        current = next;
+                    }
+                    // Chi
+                    for (int y = 0; y < 25; y += 5) {
+                        std::array<std::uint64_t, 5> row;
+                        for (int x = 0; x < 5; ++x) {
+                            row[x] = state[y + x];
+                        }
+                        for (int x = 0; x < 5; ++x) {
+                            state[y + x] = row[x] ^ (~row[(x + 1) % 5] & row[(x + 2) % 5]);
+                        }
+                    }
+                    // Iota
+                    state[0] ^= round_constant;
+                }
+            }
+
+            void AbsorbByte(std::array<std::uint64_t, 25>& state, std::size_t pos,
+                            std::byte value) {
+                state[pos / 8] ^= std::to_integer<std::uint64_t>(value) << (8 * (pos % 8));
+            }
+        }  // namespace
+
+        void NodeHasher::HashBatch(std::span<const std::span<const std::byte>> inputs,
+                                   std::span<NodeKey> outputs) const {
+            if (inputs.size() != outputs.size()) {
+                throw std::invalid_argument("Hash batch inputs and outputs sizes differ");
+            }
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                outputs[i] = Hash(inputs[i]);
+            }
+        }
+
+        // Crypto3 compiles so slow... Use this dummy hash for testing.
+        //   Hash we are going to use is still willing to change anyway
+        NodeKey BasicHasher::Hash(std::span<const std::byte> data) const {
+            std::array<std::byte, 64> result = {std::byte{0}};
+
+            for (size_t i = 0; i < data.size(); ++i) {
+                result[i % 64] ^= data[i];
+            }
+
+            for (size_t i = 0; i < 64; ++i) {
+                result[i] ^= result[(i + 1) % 64];
+                result[i] = (result[i] << 1) | (result[i] >> 7);
+            }
+
+            return NodeKey(result);
+        }
+
+        NodeKey Keccak256Hasher::Hash(std::span<const std::byte> data) const {
+            constexpr std::size_t kRate = 136;  // (1600 - 2 * 256) / 8
+
+            std::array<std::uint64_t, 25> state{};
+            while (data.size() >= kRate) {
+                for (std::size_t i = 0; i < kRate; ++i) {
+                    AbsorbByte(state, i, data[i]);
+                }
+                KeccakF1600(state);
+                data = data.subspan(kRate);
+            }
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                AbsorbByte(state, i, data[i]);
+            }
+            AbsorbByte(state, data.size(), std::byte{0x01});
+            AbsorbByte(state, kRate - 1, std::byte{0x80});
+            KeccakF1600(state);
+
+            std::array<std::byte, 32> digest;
+            for (std::size_t i = 0; i < digest.size(); ++i) {
+                digest[i] = static_cast<std::byte>(state[i / 8] >> (8 * (i % 8)));
+            }
+            return NodeKey(digest);
+        }
+
+        ParallelHasher::ParallelHasher(std::shared_ptr<const NodeHasher> inner,
+                                       std::size_t threads, std::size_t min_batch)
+            : inner_(std::move(inner)),
+              threads_(threads),
+              min_batch_(std::max<std::size_t>(min_batch, 1)) {
+            if (!inner_) {
+                throw std::invalid_argument("Parallel hasher requires inner hasher");
+            }
+            if (threads_ == 0) {
+                threads_ = std::max(std::thread::hardware_concurrency(), 1u);
+            }
+        }
+
+        void ParallelHasher::HashBatch(std::span<const std::span<const std::byte>> inputs,
+                                       std::span<NodeKey> outputs) const {
+            if (inputs.size() != outputs.size()) {
+                throw std::invalid_argument("Hash batch inputs and outputs sizes differ");
+            }
+            // Each thread gets at least min_batch_ inputs, so small batches stay on the caller
+            const auto threads = std::min(threads_, inputs.size() / min_batch_);
+            if (threads <= 1) {
+                inner_->HashBatch(inputs, outputs);
+                return;
+            }
+            const auto per_thread = (inputs.size() + threads - 1) / threads;
+            std::vector<std::jthread> workers;
+            workers.reserve(threads - 1);
+            // Calling thread hashes the last chunk instead of waiting idle
+            std::size_t begin = 0;
+            for (; begin + per_thread < inputs.size(); begin += per_thread) {
+                workers.emplace_back([this, inputs, outputs, begin, per_thread] {
+                    inner_->HashBatch(inputs.subspan(begin, per_thread),
+                                      outputs.subspan(begin, per_thread));
+                });
+            }
+            inner_->HashBatch(inputs.subspan(begin), outputs.subspan(begin));
+        }
+
+        std::shared_ptr<const NodeHasher> DefaultHasher() {
+            static const auto hasher = std::make_shared<Keccak256Hasher>();
+            return hasher;
+        }
+
+    }  // namespace mpt
+}  // namespace core
@@ -1,5 +1,11 @@
 #include "zkevm_framework/core/mpt/mpt.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
 namespace core {
     namespace mpt {
         namespace details {
@@ -37,7 +43,7 @@ namespace core {
                     if (path_.empty()) {
                         return branch_node.value();
                     }
-                    auto next = branch_node.get_branches()[std::to_integer<uint8_t>(path_.at(0))];
+                    const auto& next = branch_node.get_branch(path_.at(0));
                     if (!next.empty()) {
                         path_.Consume(1);
                         return mpt_.GetNode(next, path_);
@@ -106,21 +112,20 @@ namespace core {
                     return branchReference;
                 }
 
-                Reference operator()(const BranchNode& branch_node) {
+                // Decoded node is owned by the caller and isn't used after visiting, so it is
+                // updated in place instead of copying all branches into a new node.
+                Reference operator()(BranchNode& branch_node) {
                     if (path_.size() == 0) {
-                        return mpt_.PutToStorage(BranchNode{branch_node.get_branches(), value_});
+                        branch_node.set_value(value_);
+                        return mpt_.PutToStorage(branch_node);
                     }
 
                     auto nibble = path_.at(0);
                     path_.Consume(1);
-                    auto newReference =
-                        mpt_.SetNode(branch_node.get_branches()[std::to_integer<uint8_t>(nibble)],
-                                     path_, value_);
-
-                    auto newBranches = branch_node.get_branches();
-                    newBranches[std::to_integer<uint8_t>(nibble)] = newReference;
+                    auto newReference = mpt_.SetNode(branch_node.get_branch(nibble), path_, value_);
 
-                    return mpt_.PutToStorage(BranchNode{newBranches, branch_node.value()});
+                    branch_node.SetBranch(nibble, newReference);
+                    return mpt_.PutToStorage(branch_node);
                 }
 
               private:
@@ -239,34 +244,34 @@ namespace core {
                     }
                 }
 
-                DeleteResult operator()(const BranchNode& branch_node) {
+                // Updated in place, see SetHandler
+                DeleteResult operator()(BranchNode& branch_node) {
                     DeleteAction action;
                     std::optional<DeletionInfo> info;
-                    std::byte idx;
-                    auto branch_copy = branch_node;
+                    // Branch the key goes through, empty if the value of the node is deleted
+                    std::optional<std::byte> idx;
 
                     if (path_.empty() && branch_node.value().empty()) {
                         throw std::runtime_error("Key not found");
                     } else if (path_.empty() && !branch_node.value().empty()) {
-                        branch_copy.set_value({});
+                        branch_node.set_value({});
                         action = DeleteAction::Deleted;
                     } else {
                         idx = path_.at(0);
 
-                        if (branch_node.get_branches()[std::to_integer<uint8_t>(idx)].empty()) {
+                        if (branch_node.get_branch(*idx).empty()) {
                             throw std::runtime_error("Key not found");
                         }
 
                         Path remaining_path = path_;
                         remaining_path.Consume(1);
-                        auto result = mpt_.DeleteNode(
-                            branch_node.get_branches()[std::to_integer<uint8_t>(idx)],
-                            remaining_path);
+                        auto result =
+                            mpt_.DeleteNode(branch_node.get_branch(*idx), remaining_path);
                         action = result.action;
                         info = result.info;
                     }
 
-                    return HandleBranchDeleteResult(branch_copy, action, info, idx);
+                    return HandleBranchDeleteResult(branch_node, action, info, idx);
                 }
 
               private:
@@ -303,21 +308,20 @@ namespace core {
                         child_node);
                 }
 
-                DeleteResult HandleBranchDeleteResult(const BranchNode& branch_node,
+                DeleteResult HandleBranchDeleteResult(BranchNode& branch_node,
                                                       DeleteAction action,
                                                       const std::optional<DeletionInfo>& info,
-                                                      std::byte idx) {
+                                                      std::optional<std::byte> idx) {
                     switch (action) {
                         case DeleteAction::Deleted:
                             return HandleBranchDeletion(branch_node, idx);
 
                         case DeleteAction::Updated:
                         case DeleteAction::UselessBranch:
-                            if (info && info->ref) {
-                                auto updated_branch = branch_node;
-                                updated_branch.SetBranch(idx, info->ref.value());
+                            if (idx && info && info->ref) {
+                                branch_node.SetBranch(*idx, info->ref.value());
                                 return {DeleteAction::Updated,
-                                        DeletionInfo{{}, mpt_.PutToStorage(updated_branch)}};
+                                        DeletionInfo{{}, mpt_.PutToStorage(branch_node)}};
                             }
                             throw std::runtime_error("Invalid update info");
 
@@ -326,11 +330,14 @@ namespace core {
                     }
                 }
 
-                DeleteResult HandleBranchDeletion(const BranchNode& branch_node, std::byte idx) {
-                    auto branches = branch_node.get_branches();
-                    size_t valid_branches =
-                        std::count_if(branches.begin(), branches.end(),
-                                      [](const Reference& ref) { return !ref.empty(); });
+                DeleteResult HandleBranchDeletion(BranchNode& branch_node,
+                                                  std::optional<std::byte> idx) {
+                    // Deleted child must not be counted, otherwise a branch left with a single
+                    // child is kept or the deleted child is restored from it
+                    if (idx) {
+                        branch_node.ClearBranch(*idx);
+                    }
+                    size_t valid_branches = branch_node.CountBranches();
 
                     if (valid_branches == 0 && branch_node.value().empty()) {
                         return {DeleteAction::Deleted, std::nullopt};
@@ -340,29 +347,27 @@ namespace core {
                                 DeletionInfo{new_path, mpt_.PutToStorage(LeafNode{
                                                            new_path, branch_node.value()})}};
                     } else if (valid_branches == 1 && branch_node.value().empty()) {
-                        return BuildNewNodeFromLastBranch(branches);
+                        return BuildNewNodeFromLastBranch(branch_node);
                     } else {
-                        auto updated_branch = branch_node;
-                        updated_branch.ClearBranch(idx);
                         return {DeleteAction::Updated,
-                                DeletionInfo{{}, mpt_.PutToStorage(updated_branch)}};
+                                DeletionInfo{{}, mpt_.PutToStorage(branch_node)}};
                     }
                 }
 
-                DeleteResult BuildNewNodeFromLastBranch(
-                    const std::array<Reference, kBranchesNum>& branches) {
+                DeleteResult BuildNewNodeFromLastBranch(const BranchNode& branch_node) {
                     // Find the index of the only stored branch.
-                    auto it = std::find_if(branches.begin(), branches.end(),
-                                           [](const Reference& ref) { return !ref.empty(); });
-                    if (it == branches.end()) {
+                    uint8_t idx = 0;
+                    while (idx < kBranchesNum && branch_node.get_branch(std::byte{idx}).empty()) {
+                        ++idx;
+                    }
+                    if (idx == kBranchesNum) {
                         throw std::runtime_error("No valid branches found");
                     }
-
-                    uint8_t idx = std::distance(branches.begin(), it);
+                    const auto& last_branch = branch_node.get_branch(std::byte{idx});
 
                     // Path in leaf will contain one nibble (at this step).
                     Path prefixNibble({std::byte{idx}}, 1);
-                    auto child = mpt_.GetFromStorage(*it);
+                    auto child = mpt_.GetFromStorage(last_branch);
 
                     return std::visit(
                         overloaded{
@@ -381,43 +386,244 @@ namespace core {
                             },
                             [&](const BranchNode&) -> DeleteResult {
                                 return {DeleteAction::UselessBranch,
-                                        DeletionInfo{prefixNibble, mpt_.PutToStorage(ExtensionNode{
-                                                                       prefixNibble, *it})}};
+                                        DeletionInfo{prefixNibble,
+                                                     mpt_.PutToStorage(ExtensionNode{
+                                                         prefixNibble, last_branch})}};
                             }},
                         child);
                 }
             };
-        }  // namespace details
 
-        // Crypto3 compiles so slow... Use this dummy hash for testing.
-        //   Hash we are going to use is still willing to change anyway
-        std::array<std::byte, 64> BasicHash(const std::vector<std::byte>& key) {
-            std::array<std::byte, 64> result = {std::byte{0}};
+            /// Builds trie bottom-up from sorted entries with unique keys. Nodes of the same height
+            /// don't depend on each other, so a whole height is encoded first and then hashed with
+            /// a single batch call.
+            class BulkBuilder {
+              public:
+                using Nibbles = std::vector<std::uint8_t>;
+                using Entry = std::pair<Nibbles, std::vector<std::byte>>;
 
-            for (size_t i = 0; i < key.size(); ++i) {
-                result[i % 64] ^= key[i];
-            }
+                BulkBuilder(MerklePatriciaTrie& mpt, const std::vector<Entry>& entries)
+                    : mpt_(mpt), entries_(entries) {}
 
-            for (size_t i = 0; i < 64; ++i) {
-                result[i] ^= result[(i + 1) % 64];
-                result[i] = (result[i] << 1) | (result[i] >> 7);
-            }
+                Reference Build() {
+                    if (entries_.empty()) {
+                        return {};
+                    }
+                    const auto root = BuildRange(0, entries_.size(), 0);
+                    HashByHeight();
+                    return std::move(pending_[root].ref);
+                }
+
+              private:
+                static constexpr std::size_t kNoChild = std::numeric_limits<std::size_t>::max();
+
+                enum class Kind { Leaf, Extension, Branch };
+
+                struct PendingNode {
+                    Kind kind;
+                    Path path;
+                    const std::vector<std::byte>* value = nullptr;
+                    std::array<std::size_t, kBranchesNum> children;
+                    std::size_t height = 0;
+                    Reference ref;
+                };
+
+                static Path PathFromNibbles(const Nibbles& nibbles, std::size_t begin,
+                                            std::size_t end) {
+                    std::vector<std::byte> data;
+                    data.reserve((end - begin + 1) / 2);
+                    const bool is_odd = (end - begin) % 2 == 1;
+                    if (is_odd) {
+                        data.push_back(std::byte{nibbles[begin++]});
+                    }
+                    for (; begin < end; begin += 2) {
+                        data.push_back(std::byte(nibbles[begin] << 4 | nibbles[begin + 1]));
+                    }
+                    return Path(data, is_odd ? 1 : 0);
+                }
+
+                std::size_t AddNode(PendingNode node) {
+                    pending_.push_back(std::move(node));
+                    return pending_.size() - 1;
+                }
+
+                std::size_t BuildRange(std::size_t begin, std::size_t end, std::size_t depth) {
+                    const auto& first = entries_[begin].first;
+                    if (end - begin == 1) {
+                        return AddNode({.kind = Kind::Leaf,
+                                        .path = PathFromNibbles(first, depth, first.size()),
+                                        .value = &entries_[begin].second});
+                    }
+                    // Entries are sorted, so the common prefix of the range is the common prefix
+                    // of its first and last keys
+                    const auto& last = entries_[end - 1].first;
+                    std::size_t common = depth;
+                    while (common < first.size() && common < last.size() &&
+                           first[common] == last[common]) {
+                        ++common;
+                    }
+                    const auto branch = BuildBranch(begin, end, common);
+                    if (common == depth) {
+                        return branch;
+                    }
+                    PendingNode extension{.kind = Kind::Extension,
+                                          .path = PathFromNibbles(first, depth, common),
+                                          .height = pending_[branch].height + 1};
+                    extension.children[0] = branch;
+                    return AddNode(std::move(extension));
+                }
+
+                std::size_t BuildBranch(std::size_t begin, std::size_t end, std::size_t depth) {
+                    PendingNode branch{.kind = Kind::Branch};
+                    branch.children.fill(kNoChild);
+                    // Key ending at this branch is the smallest one in the range
+                    if (entries_[begin].first.size() == depth) {
+                        branch.value = &entries_[begin].second;
+                        ++begin;
+                    }
+                    while (begin < end) {
+                        const auto nibble = entries_[begin].first[depth];
+                        auto group_end = begin + 1;
+                        while (group_end < end && entries_[group_end].first[depth] == nibble) {
+                            ++group_end;
+                        }
+                        const auto child = BuildRange(begin, group_end, depth + 1);
+                        branch.children[nibble] = child;
+                        branch.height = std::max(branch.height, pending_[child].height + 1);
+                        begin = group_end;
+                    }
+                    return AddNode(std::move(branch));
+                }
+
+                void Encode(PendingNode& node, Bytes& buffer) {
+                    switch (node.kind) {
+                        case Kind::Leaf: {
+                            LeafNode(node.path, *node.value).EncodeTo(buffer);
+                            break;
+                        }
+                        case Kind::Extension: {
+                            ExtensionNode(node.path, pending_[node.children[0]].ref)
+                                .EncodeTo(buffer);
+                            break;
+                        }
+                        case Kind::Branch: {
+                            std::array<Reference, kBranchesNum> refs;
+                            for (std::size_t i = 0; i < kBranchesNum; ++i) {
+                                if (node.children[i] != kNoChild) {
+                                    refs[i] = std::move(pending_[node.children[i]].ref);
+                                }
+                            }
+                            BranchNode(refs, node.value ? *node.value : std::vector<std::byte>{})
+                                .EncodeTo(buffer);
+                            break;
+                        }
+                    }
+                }
+
+                void HashByHeight() {
+                    std::vector<std::vector<std::size_t>> heights;
+                    for (std::size_t idx = 0; idx < pending_.size(); ++idx) {
+                        const auto height = pending_[idx].height;
+                        if (heights.size() <= height) {
+                            heights.resize(height + 1);
+                        }
+                        heights[height].push_back(idx);
+                    }
+
+                    std::vector<std::size_t> hashed;
+                    std::vector<std::span<const std::byte>> encodings;
+                    std::vector<NodeKey> digests;
+                    for (const auto& nodes : heights) {
+                        hashed.clear();
+                        encodings.clear();
+                        for (const auto idx : nodes) {
+                            auto& node = pending_[idx];
+                            Encode(node, mpt_.encode_buffer_);
+                            if (mpt_.encode_buffer_.size() < 32) {
+                                node.ref = mpt_.encode_buffer_;
+                                continue;
+                            }
+                            hashed.push_back(idx);
+                            encodings.push_back(mpt_.arena_.store(mpt_.encode_buffer_));
+                        }
 
-            return result;
+                        digests.resize(encodings.size());
+                        mpt_.hasher_->HashBatch(encodings, digests);
+                        for (std::size_t i = 0; i < hashed.size(); ++i) {
+                            mpt_.nodes_.insert_or_assign(digests[i], encodings[i]);
+                            pending_[hashed[i]].ref = digests[i].to_vector();
+                        }
+                    }
+                }
+
+                MerklePatriciaTrie& mpt_;
+                const std::vector<Entry>& entries_;
+                std::vector<PendingNode> pending_;
+            };
+        }  // namespace details
+
+        MerklePatriciaTrie::MerklePatriciaTrie(std::shared_ptr<const NodeHasher> hasher)
+            : hasher_(std::move(hasher)) {
+            if (!hasher_) {
+                throw std::invalid_argument("MPT hasher is not set");
+            }
+            if (hasher_->digest_size() < 32 || hasher_->digest_size() > NodeKey::kMaxSize) {
+                throw std::invalid_argument("Unsupported MPT hasher digest size");
+            }
         }
 
-        MerklePatriciaTrie::MerklePatriciaTrie(){};
+        MerklePatriciaTrie::MerklePatriciaTrie(Reference root, NodeLoader loader,
+                                               std::shared_ptr<const NodeHasher> hasher)
+            : MerklePatriciaTrie(std::move(hasher)) {
+            root_ = std::move(root);
+            loader_ = std::move(loader);
+        }
 
-        Path MerklePatriciaTrie::PathFromKey(const std::vector<std::byte>& key) {
-            std::vector<std::byte> hash_result;
+        std::vector<std::byte> MerklePatriciaTrie::KeyBytes(
+            const std::vector<std::byte>& key) const {
             if (key.size() > kMaxRawKeyLen) {
-                auto hash_array = BasicHash(key);
-                hash_result = std::vector<std::byte>(hash_array.begin(), hash_array.end());
-            } else {
-                hash_result = key;
+                return hasher_->Hash(key).to_vector();
+            }
+            return key;
+        }
+
+        Path MerklePatriciaTrie::PathFromKey(const std::vector<std::byte>& key) const {
+            return Path(KeyBytes(key));
+        }
+
+        void MerklePatriciaTrie::build(
+            std::vector<std::pair<std::vector<std::byte>, std::vector<std::byte>>> entries) {
+            std::vector<details::BulkBuilder::Entry> paths;
+            paths.reserve(entries.size());
+            for (auto& [key, value] : entries) {
+                details::BulkBuilder::Nibbles nibbles;
+                const auto key_bytes = KeyBytes(key);
+                nibbles.reserve(key_bytes.size() * 2);
+                for (const auto byte : key_bytes) {
+                    nibbles.push_back(std::to_integer<std::uint8_t>(byte >> 4));
+                    nibbles.push_back(std::to_integer<std::uint8_t>(byte & std::byte{0x0F}));
+                }
+                paths.emplace_back(std::move(nibbles), std::move(value));
+            }
+            std::stable_sort(paths.begin(), paths.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+            // Stable sort keeps duplicates in insertion order, keep the last one of each run
+            std::size_t unique_end = 0;
+            for (std::size_t i = 0; i < paths.size(); ++i) {
+                if (i + 1 < paths.size() && paths[i].first == paths[i + 1].first) {
+                    continue;
+                }
+                if (unique_end != i) {
+                    paths[unique_end] = std::move(paths[i]);
+                }
+                ++unique_end;
             }
+            paths.resize(unique_end);
 
-            return Path(hash_result);
+            nodes_.clear();
+            arena_.clear();
+            nodes_.reserve(paths.size() * 2);
+            root_ = details::BulkBuilder(*this, paths).Build();
         }
 
         std::vector<std::byte> MerklePatriciaTrie::get(const std::vector<std::byte>& key) const {
@@ -434,6 +640,15 @@ namespace core {
             throw std::runtime_error("Key not found");
         }
 
+        std::optional<std::vector<std::byte>> MerklePatriciaTrie::find(
+            const std::vector<std::byte>& key) const {
+            if (root_.empty()) {
+                return std::nullopt;
+            }
+            auto path = PathFromKey(key);
+            return GetNode(root_, path);
+        }
+
         std::optional<std::vector<std::byte>> MerklePatriciaTrie::GetNode(const Reference& node_ref,
                                                                           Path& path) const {
             auto node = GetFromStorage(node_ref);
@@ -457,11 +672,15 @@ namespace core {
             switch (result.action) {
                 case details::DeleteAction::Deleted: {
                     root_.clear();
+                    return;
                 }
-                case details::DeleteAction::Updated: {
-                }
-                case details::DeleteAction::Unknown: {
-                    root_ = *(result.info->ref);
+                // Root branch left with a single child is replaced by the node built from it
+                case details::DeleteAction::Updated:
+                case details::DeleteAction::UselessBranch: {
+                    if (!result.info || !result.info->ref) {
+                        throw std::runtime_error("Invalid remove result");
+                    }
+                    root_ = std::move(*result.info->ref);
                     return;
                 }
                 default: {
@@ -480,23 +699,47 @@ namespace core {
             if (ref.size() < 32) {
                 return DecodeNode(ref);
             }
-            auto it = nodes_.find(ref);
-            if (it == nodes_.end()) {
+            const NodeKey key(ref);
+            const auto* encoded = nodes_.find(key);
+            if (encoded != nullptr) {
+                return DecodeNode(*encoded);
+            }
+            if (!loader_) {
                 throw std::runtime_error("Node not found");
             }
 
-            return DecodeNode(it->second);
+            const auto loaded = loader_(ref);
+            if (!loaded) {
+                throw std::runtime_error("Node not found");
+            }
+            if (!(hasher_->Hash(*loaded) == key)) {
+                throw std::runtime_error("Loaded node does not match its reference");
+            }
+            nodes_.insert_or_assign(key, arena_.store(*loaded));
+            return DecodeNode(*loaded);
         }
 
-        Reference MerklePatriciaTrie::PutToStorage(const Node& node) {
-            Bytes encoded = std::visit([](const auto& n) { return n.Encode(); }, node);
-            if (encoded.size() < 32) {
-                return encoded;
+        std::optional<Bytes> MerklePatriciaTrie::find_node(const Reference& ref) const {
+            if (ref.size() < 32) {
+                return ref;
             }
-            auto key_arr = BasicHash(encoded);
-            Bytes key(key_arr.begin(), key_arr.end());
-            nodes_[key] = encoded;
-            return key;
+            const auto* encoded = nodes_.find(NodeKey(ref));
+            if (encoded == nullptr) {
+                return std::nullopt;
+            }
+            return Bytes(encoded->begin(), encoded->end());
+        }
+
+        Reference MerklePatriciaTrie::PutToStorage(const Serializable& node) {
+            node.EncodeTo(encode_buffer_);
+            if (encode_buffer_.size() < 32) {
+                return encode_buffer_;
+            }
+            const auto key = hasher_->Hash(encode_buffer_);
+            if (!nodes_.contains(key)) {
+                nodes_.insert_or_assign(key, arena_.store(encode_buffer_));
+            }
+            return key.to_vector();
         }
 
         Reference MerklePatriciaTrie::SetNode(const Reference& node_ref, Path& path,
@@ -1,5 +1,6 @@
 #include "zkevm_framework/core/mpt/node.hpp"
 
+#include <algorithm>
 #include <span>
 #include <stdexcept>
 
@@ -17,21 +18,19 @@ namespace core {
         LeafNode::LeafNode(const Path& path, const std::vector<std::byte>& new_value)
             : PathHolder(path), ValueHolder(new_value) {}
 
-        Bytes LeafNode::Encode() const {
-            auto serialized = std::vector<std::byte>(ssz_size() + 1);
-            serialized.front() = static_cast<std::byte>(NodeTypeFlag::kLeafNode);
-            ssz::serialize(serialized.begin() + 1, *this);
-            return serialized;
+        void LeafNode::EncodeTo(Bytes& buffer) const {
+            buffer.resize(ssz_size() + 1);
+            buffer.front() = static_cast<std::byte>(NodeTypeFlag::kLeafNode);
+            ssz::serialize(buffer.begin() + 1, *this);
         }
 
         ExtensionNode::ExtensionNode(const Path& path, const Reference& next)
             : PathHolder(path), next_ref_(next) {}
 
-        Bytes ExtensionNode::Encode() const {
-            auto serialized = std::vector<std::byte>(ssz_size() + 1);
-            serialized.front() = static_cast<std::byte>(NodeTypeFlag::kExtensionNode);
-            ssz::serialize(serialized.begin() + 1, *this);
-            return serialized;
+        void ExtensionNode::EncodeTo(Bytes& buffer) const {
+            buffer.resize(ssz_size() + 1);
+            buffer.front() = static_cast<std::byte>(NodeTypeFlag::kExtensionNode);
+            ssz::serialize(buffer.begin() + 1, *this);
         }
 
         const Reference& ExtensionNode::get_next_ref() const { return next_ref_.data(); }
@@ -44,11 +43,10 @@ namespace core {
             }
         }
 
-        Bytes BranchNode::Encode() const {
-            auto serialized = std::vector<std::byte>(ssz_size() + 1);
-            serialized.front() = static_cast<std::byte>(NodeTypeFlag::kBranchNode);
-            ssz::serialize(serialized.begin() + 1, *this);
-            return serialized;
+        void BranchNode::EncodeTo(Bytes& buffer) const {
+            buffer.resize(ssz_size() + 1);
+            buffer.front() = static_cast<std::byte>(NodeTypeFlag::kBranchNode);
+            ssz::serialize(buffer.begin() + 1, *this);
         }
 
         std::array<Reference, kBranchesNum> BranchNode::get_branches() const {
@@ -60,6 +58,16 @@ namespace core {
             return arr;
         }
 
+        const Reference& BranchNode::get_branch(std::byte nibble) const {
+            return branches_.data()[std::to_integer<uint8_t>(nibble)].data();
+        }
+
+        std::size_t BranchNode::CountBranches() const {
+            const auto& branches_vec = branches_.data();
+            return std::count_if(branches_vec.begin(), branches_vec.end(),
+                                 [](const auto& ref) { return !ref.data().empty(); });
+        }
+
         void BranchNode::ClearBranch(std::byte nibble) {
             branches_[std::to_integer<uint8_t>(nibble)].data().clear();
         }
@@ -73,13 +81,13 @@ namespace core {
             return ssz::deserialize<NodeType>(bytes);
         }
 
-        Node DecodeNode(const Bytes& bytes) {
+        Node DecodeNode(std::span<const std::byte> bytes) {
             if (bytes.empty()) {
                 throw std::runtime_error("Empty byte array");
             }
 
             const auto type_flag = static_cast<NodeTypeFlag>(bytes.front());
-            std::span<const std::byte> data_span(bytes.data() + 1, bytes.size() - 1);
+            auto data_span = bytes.subspan(1);
 
             switch (type_flag) {
                 case NodeTypeFlag::kLeafNode:
@@ -93,5 +101,7 @@ namespace core {
             }
         }
 
+        Node DecodeNode(const Bytes& bytes) { return DecodeNode(std::span<const std::byte>(bytes)); }
+
     }  // namespace mpt
 }  // namespace core
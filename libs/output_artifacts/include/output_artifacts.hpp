@@ -118,6 +118,9 @@ struct OutputArtifacts {
     /// @brief Selector columns in every table to write.
     Ranges selector_columns;
 
+    /// @brief Compress text with gzip, `.gz` is appended to file names.
+    bool gzip;
+
     /// @brief Default constructor creates no artifacts and stdout output.
     OutputArtifacts()
         : basename("-"),
@@ -126,7 +129,8 @@ struct OutputArtifacts {
           witness_columns({}),
           public_input_columns({}),
           constant_columns({}),
-          selector_columns({}) {}
+          selector_columns({}),
+          gzip(false) {}
 
     /// @brief Whether write output into stdout or into file.
     bool to_stdout() const { return basename == "-"; }
@@ -196,5 +196,7 @@ std::expected<OutputArtifacts, std::string> OutputArtifacts::from_program_option
         artifacts.selector_columns = maybe_columns.value()[3];
     }
 
+    artifacts.gzip = vm.count("output-text-gzip") > 0;
+
     return artifacts;
 }
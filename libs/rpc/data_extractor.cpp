@@ -45,3 +45,25 @@ std::optional<std::string> data_extractor::get_account_with_storage(
         return "Response error code: " + httplib::to_string(res.error());
     }
 }
+
+std::optional<std::string> data_extractor::get_storage_at(const std::string& address,
+                                                          const std::string& key,
+                                                          const std::string& blockHash,
+                                                          std::stringstream& slot_data) const {
+    httplib::Client cli(m_host, m_port);
+    httplib::Headers headers = {};
+    std::string body =
+        "{\"id\":1,\"jsonrpc\":\"2.0\",\"method\":\"eth_getStorageAt\",\"params\":[";
+    body += "\"" + address + "\"";
+    body += ",\"" + key + "\"";
+    body += ",\"" + blockHash + "\"]}";
+    BOOST_LOG_TRIVIAL(debug) << body << "\n";
+    if (auto res = cli.Post("/", headers, body.c_str(), body.size(), "application/json")) {
+        BOOST_LOG_TRIVIAL(debug) << res->body << "\n";
+
+        slot_data << res->body;
+        return {};
+    } else {
+        return "Response error code: " + httplib::to_string(res.error());
+    }
+}
@@ -0,0 +1,179 @@
+#include "zkevm_framework/rpc/fixture_server.hpp"
+
+#include <httplib.h>
+
+#include <algorithm>
+#include <boost/json/object.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/log/trivial.hpp>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+namespace {
+    // Error codes are defined by JSON-RPC 2.0 specification
+    constexpr int kInvalidRequest = -32600;
+    constexpr int kFixtureNotFound = -32001;
+
+    std::string make_error(const boost::json::value& id, int code, const std::string& message) {
+        return boost::json::serialize(boost::json::object{
+            {"jsonrpc", "2.0"},
+            {"id", id},
+            {"error", boost::json::object{{"code", code}, {"message", message}}},
+        });
+    }
+}  // namespace
+
+fixture_server::fixture_server(fixture_server_options options)
+    : m_options(std::move(options)), m_server(std::make_unique<httplib::Server>()) {}
+
+fixture_server::~fixture_server() = default;
+
+std::optional<std::string> fixture_server::run() {
+    std::error_code ec;
+    if (m_options.record_from) {
+        std::filesystem::create_directories(m_options.fixtures_dir, ec);
+    }
+    if (ec || !std::filesystem::is_directory(m_options.fixtures_dir)) {
+        return "Fixtures directory " + m_options.fixtures_dir + " is not available";
+    }
+
+    const std::size_t threads = std::max<std::size_t>(m_options.threads, 1);
+    m_server->new_task_queue = [threads] { return new httplib::ThreadPool(threads); };
+    m_server->Post("/", [this](const httplib::Request& req, httplib::Response& res) {
+        res.set_content(handle(req.body), "application/json");
+    });
+
+    BOOST_LOG_TRIVIAL(info) << "Fixture server listens on " << m_options.listen.host << ":"
+                            << m_options.listen.port
+                            << (m_options.record_from ? ", recording" : ", replaying");
+    if (!m_server->listen(m_options.listen.host, m_options.listen.port)) {
+        return "Could not listen on " + m_options.listen.host + ":" +
+               std::to_string(m_options.listen.port);
+    }
+    return {};
+}
+
+void fixture_server::stop() { m_server->stop(); }
+
+void fixture_server::wait_until_ready() const { m_server->wait_until_ready(); }
+
+std::string fixture_server::handle(const std::string& request_body) {
+    boost::json::error_code ec;
+    auto request = boost::json::parse(request_body, ec);
+    if (ec || !request.is_object()) {
+        return make_error(nullptr, kInvalidRequest, "Request is not a JSON object");
+    }
+    const auto& object = request.as_object();
+    const auto* id = object.if_contains("id");
+    const auto* method = object.if_contains("method");
+    const auto* params = object.if_contains("params");
+    const boost::json::value request_id = id ? *id : boost::json::value(nullptr);
+    if (!method || !method->is_string() || (params && !params->is_array())) {
+        return make_error(request_id, kInvalidRequest, "Method or params are invalid");
+    }
+
+    const auto name = fixture_name(std::string(method->as_string()),
+                                   params ? params->as_array() : boost::json::array{});
+    auto fixture = load_fixture(name);
+    if (fixture) {
+        ++m_hits;
+    } else if (m_options.record_from) {
+        auto err = record_fixture(name, request_body);
+        if (err) {
+            return make_error(request_id, kFixtureNotFound, err.value());
+        }
+        fixture = load_fixture(name);
+    }
+    if (!fixture) {
+        ++m_misses;
+        BOOST_LOG_TRIVIAL(warning) << "Fixture " << name << " not found";
+        return make_error(request_id, kFixtureNotFound, "Fixture " + name + " not found");
+    }
+
+    auto response = boost::json::parse(fixture.value(), ec);
+    if (ec || !response.is_object()) {
+        return make_error(request_id, kFixtureNotFound, "Fixture " + name + " is corrupted");
+    }
+    response.as_object()["id"] = request_id;
+    delay();
+    return boost::json::serialize(response);
+}
+
+std::string fixture_server::fixture_name(const std::string& method,
+                                         const boost::json::array& params) {
+    // Params of node methods are hashes, addresses and numbers, so they are kept readable
+    std::string name = method;
+    for (const auto& param : params) {
+        name += '.';
+        name += param.is_string() ? std::string(param.as_string()) : boost::json::serialize(param);
+    }
+    for (auto& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '_') {
+            c = '_';
+        }
+    }
+    return name + ".json";
+}
+
+std::optional<std::string> fixture_server::load_fixture(const std::string& name) const {
+    std::ifstream in(std::filesystem::path(m_options.fixtures_dir) / name);
+    if (!in.is_open()) {
+        return {};
+    }
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+std::optional<std::string> fixture_server::record_fixture(const std::string& name,
+                                                          const std::string& request_body) {
+    const auto& upstream = m_options.record_from.value();
+    httplib::Client cli(upstream.host, upstream.port);
+    auto res = cli.Post("/", httplib::Headers{}, request_body.c_str(), request_body.size(),
+                        "application/json");
+    if (!res) {
+        return "Response error code: " + httplib::to_string(res.error());
+    }
+    if (res->status != 200) {
+        return "Node responded with status " + std::to_string(res->status);
+    }
+
+    // Concurrent requests may record the same fixture, the last rename wins
+    const auto path = std::filesystem::path(m_options.fixtures_dir) / name;
+    std::ostringstream tmp_name;
+    tmp_name << name << ".tmp" << std::this_thread::get_id();
+    const auto tmp_path = std::filesystem::path(m_options.fixtures_dir) / tmp_name.str();
+    {
+        std::ofstream out(tmp_path, std::ios_base::out | std::ios_base::trunc);
+        if (!out.is_open()) {
+            return "Cannot open " + tmp_path.string();
+        }
+        out << res->body;
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        return "Cannot save fixture " + path.string() + ": " + ec.message();
+    }
+    ++m_recorded;
+    BOOST_LOG_TRIVIAL(debug) << "Recorded fixture " << name;
+    return {};
+}
+
+void fixture_server::delay() const {
+    auto delay = m_options.latency;
+    if (m_options.latency_jitter.count() > 0) {
+        thread_local std::mt19937_64 rng{std::random_device{}()};
+        std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(
+            0, m_options.latency_jitter.count());
+        delay += std::chrono::milliseconds(jitter(rng));
+    }
+    if (delay.count() > 0) {
+        std::this_thread::sleep_for(delay);
+    }
+}
@@ -8,15 +8,30 @@
 #include "zkevm_framework/core/types/account.hpp"
 #include "zkevm_framework/core/types/block.hpp"
 
+/// @brief Address of the node serving JSON-RPC requests
+struct rpc_endpoint {
+    std::string host = "127.0.0.1";
+    int port = 8529;
+};
+
 class data_extractor {
   public:
     data_extractor(std::string host, int port, uint64_t shard_id)
         : m_host(host), m_port(port), m_shard_id(shard_id) {}
+    data_extractor(const rpc_endpoint& endpoint, uint64_t shard_id)
+        : data_extractor(endpoint.host, endpoint.port, shard_id) {}
+
+    uint64_t shard_id() const { return m_shard_id; }
+
     std::optional<std::string> get_block_with_messages(const std::string& blockHash,
                                                        std::stringstream& block_data) const;
     std::optional<std::string> get_account_with_storage(const std::string& address,
                                                         const std::string& blockHash,
                                                         std::stringstream& account_data) const;
+    /// @brief Get single storage slot of the contract at the given block
+    std::optional<std::string> get_storage_at(const std::string& address, const std::string& key,
+                                              const std::string& blockHash,
+                                              std::stringstream& slot_data) const;
 
   private:
     std::string m_host;
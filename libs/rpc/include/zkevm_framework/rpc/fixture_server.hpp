@@ -0,0 +1,81 @@
+/**
+ * @file fixture_server.hpp
+ *
+ * @brief JSON-RPC server replaying recorded node responses from disk.
+ */
+
+#ifndef ZKEMV_FRAMEWORK_LIBS_RPC_FIXTURE_SERVER_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_RPC_FIXTURE_SERVER_HPP_
+
+#include <atomic>
+#include <boost/json/array.hpp>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "zkevm_framework/rpc/data_extractor.hpp"
+
+namespace httplib {
+    class Server;
+}  // namespace httplib
+
+struct fixture_server_options {
+    /// @brief Directory of fixture files, one file per method and parameters
+    std::string fixtures_dir;
+    /// @brief If set, requests missing in fixtures are forwarded to this node and its responses
+    /// are saved
+    std::optional<rpc_endpoint> record_from;
+    /// @brief Address served by the fixture server
+    rpc_endpoint listen;
+    /// @brief Delay added to every response
+    std::chrono::milliseconds latency{0};
+    /// @brief Upper bound of uniformly distributed delay added on top of latency
+    std::chrono::milliseconds latency_jitter{0};
+    /// @brief Number of requests handled concurrently
+    std::size_t threads = 4;
+};
+
+/// @brief Serves node responses recorded once, so performance runs don't depend on a cluster.
+///
+/// In replay mode every request is answered from `<fixtures_dir>/<fixture_name>`, a request
+/// without fixture gets JSON-RPC error. In record mode missing fixtures are fetched from the
+/// node and saved. Id of the response is always set to id of the request.
+class fixture_server {
+  public:
+    explicit fixture_server(fixture_server_options options);
+    ~fixture_server();
+
+    /// @brief Start serving requests, returns when the server is stopped
+    std::optional<std::string> run();
+
+    void stop();
+
+    /// @brief Block until the server started by `run` on another thread accepts requests
+    void wait_until_ready() const;
+
+    /// @brief Answer JSON-RPC request body, exposed for serving without a socket
+    std::string handle(const std::string& request_body);
+
+    /// @brief File name of the fixture storing response to the method called with the params
+    static std::string fixture_name(const std::string& method, const boost::json::array& params);
+
+    std::size_t hits() const { return m_hits; }
+    std::size_t misses() const { return m_misses; }
+    std::size_t recorded() const { return m_recorded; }
+
+  private:
+    std::optional<std::string> load_fixture(const std::string& name) const;
+    std::optional<std::string> record_fixture(const std::string& name,
+                                              const std::string& request_body);
+    void delay() const;
+
+    fixture_server_options m_options;
+    std::unique_ptr<httplib::Server> m_server;
+    std::atomic<std::size_t> m_hits{0};
+    std::atomic<std::size_t> m_misses{0};
+    std::atomic<std::size_t> m_recorded{0};
+};
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_RPC_FIXTURE_SERVER_HPP_
@@ -0,0 +1,168 @@
+#include "checks.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table_definition.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <string>
+
+namespace {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using circuit_type = nil::blueprint::circuit<ArithmetizationType<BlueprintFieldType>>;
+    using assignment_type = nil::blueprint::assignment<ArithmetizationType<BlueprintFieldType>>;
+    using value_type = typename BlueprintFieldType::value_type;
+    using var = nil::crypto3::zk::snark::plonk_variable<value_type>;
+    using constraint_type = nil::crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
+    using lookup_constraint_type =
+        nil::crypto3::zk::snark::plonk_lookup_constraint<BlueprintFieldType>;
+
+    constexpr std::size_t rows = 4096;
+
+    // Gate 0 checks w2 = w0 * w1, gate 1 checks w3 = w2 + 1 on every row, copy constraint `i`
+    // ties w3 of row `i` to w0 of row `i + 1`. w1 is zero on rows divisible by 3, so w0 of these
+    // rows is bound by the copy constraint only
+    void make_circuit(circuit_type& bp, assignment_type& table) {
+        bp.add_gate(std::vector<constraint_type>{var(0, 0) * var(1, 0) - var(2, 0)});
+        bp.add_gate(std::vector<constraint_type>{var(2, 0) + value_type::one() - var(3, 0)});
+        for (std::size_t row = 0; row + 1 < rows; row++) {
+            bp.add_copy_constraint({var(3, row, false), var(0, row + 1, false)});
+        }
+        value_type w0 = value_type::one();
+        for (std::size_t row = 0; row < rows; row++) {
+            table.witness(0, row) = w0;
+            table.witness(1, row) = value_type(row % 3);
+            table.witness(2, row) = w0 * (row % 3);
+            table.witness(3, row) = table.witness(2, row) + value_type::one();
+            w0 = table.witness(3, row);
+            table.enable_selector(0, row);
+            table.enable_selector(1, row);
+        }
+    }
+
+    std::string check(const circuit_type& bp, const assignment_type& table,
+                      satisfiability_check_options options) {
+        const auto report = check_satisfiability<BlueprintFieldType>(bp, table, options);
+        return report.is_satisfied() ? "satisfied" : report.failure->to_string();
+    }
+}  // namespace
+
+TEST(checks_test, satisfied_table) {
+    circuit_type bp;
+    assignment_type table(4, 0, 0, 2);
+    make_circuit(bp, table);
+    const auto report = check_satisfiability<BlueprintFieldType>(bp, table, {.block_rows = 100});
+    EXPECT_TRUE(report.is_satisfied());
+    EXPECT_EQ(report.rows_checked, rows);
+    EXPECT_EQ(report.copy_constraints_checked, rows - 1);
+}
+
+TEST(checks_test, violated_gate) {
+    circuit_type bp;
+    assignment_type table(4, 0, 0, 2);
+    make_circuit(bp, table);
+    // Breaks gate 1 on row 1500 and gate 0 on rows 2000 and 3000
+    table.witness(3, 1500) += value_type::one();
+    table.witness(2, 2000) += value_type::one();
+    table.witness(1, 3000) += value_type::one();
+    // The failure on the first row is reported whatever the number of threads
+    for (const std::size_t threads : {1, 2, 8}) {
+        EXPECT_EQ(check(bp, table, {.threads = threads, .block_rows = 64}),
+                  "gate 1 constraint 0 on row 1500")
+            << threads << " threads";
+    }
+}
+
+TEST(checks_test, violated_copy_constraint) {
+    circuit_type bp;
+    assignment_type table(4, 0, 0, 2);
+    make_circuit(bp, table);
+    table.witness(0, 999) += value_type::one();
+    table.witness(0, 2100) += value_type::one();
+    for (const std::size_t threads : {1, 8}) {
+        EXPECT_EQ(check(bp, table, {.threads = threads, .block_rows = 64}), "copy constraint 998")
+            << threads << " threads";
+    }
+}
+
+TEST(checks_test, gate_failure_precedes_copy_constraint_failure) {
+    circuit_type bp;
+    assignment_type table(4, 0, 0, 2);
+    make_circuit(bp, table);
+    // Breaks copy constraint 98 and gate 0 on the last row
+    table.witness(0, 99) += value_type::one();
+    table.witness(1, rows - 1) += value_type::one();
+    for (const std::size_t threads : {1, 8}) {
+        EXPECT_EQ(check(bp, table, {.threads = threads, .block_rows = 64}),
+                  "gate 0 constraint 0 on row " + std::to_string(rows - 1))
+            << threads << " threads";
+    }
+}
+
+TEST(checks_test, violated_lookup_gate) {
+    // Gate 0 checks w1 = w0, lookup gate 0 checks that w0 is a byte. Byte table is packed into
+    // constant column 1 with its own selector
+    circuit_type bp;
+    assignment_type table(2, 0, 2, 3);
+    bp.add_gate(std::vector<constraint_type>{var(1, 0) - var(0, 0)});
+    bp.reserve_table("byte_range_table/full");
+    const auto table_id = bp.get_reserved_indices().at("byte_range_table/full");
+    const auto lookup_selector =
+        bp.add_lookup_gate(std::vector<lookup_constraint_type>{{table_id, {var(0, 0)}}});
+    for (std::size_t row = 0; row < rows; row++) {
+        table.witness(0, row) = value_type(row % 256);
+        table.witness(1, row) = value_type(row % 256);
+        table.enable_selector(0, row);
+        table.enable_selector(lookup_selector, row);
+    }
+    nil::crypto3::zk::snark::pack_lookup_tables_horizontal(
+        bp.get_reserved_indices(), bp.get_reserved_tables(), bp.get_reserved_dynamic_tables(), bp,
+        table, std::vector<std::size_t>{1}, lookup_selector + 1, table.rows_amount(), 500000);
+    ASSERT_EQ(check(bp, table, {.block_rows = 64}), "satisfied");
+
+    // Breaks lookup gate 0 on rows 1500 and 3000 and gate 0 on row 2000. Failing lookup is
+    // reported on its row even if a gate fails later in the same block of rows
+    table.witness(0, 1500) = table.witness(1, 1500) = value_type(256);
+    table.witness(0, 3000) = table.witness(1, 3000) = value_type(300);
+    table.witness(1, 2000) += value_type::one();
+    for (const std::size_t block_rows : {64, 4096}) {
+        for (const std::size_t threads : {1, 8}) {
+            EXPECT_EQ(check(bp, table, {.threads = threads, .block_rows = block_rows}),
+                      "lookup gate 0 on row 1500")
+                << threads << " threads, " << block_rows << " block rows";
+        }
+    }
+
+    // Gate failing on an earlier row of the same block is reported first
+    table.witness(1, 1000) += value_type::one();
+    EXPECT_EQ(check(bp, table, {.block_rows = 4096}), "gate 0 constraint 0 on row 1000");
+}
+
+TEST(checks_test, sampled_check) {
+    EXPECT_EQ(satisfiability_sample_size(0.99, 0.01), 459);
+    EXPECT_EQ(satisfiability_sample_size(0.5, 0.5), 1);
+
+    circuit_type bp;
+    assignment_type table(4, 0, 0, 2);
+    make_circuit(bp, table);
+    const satisfiability_check_options options{
+        .threads = 4, .block_rows = 16, .sampled = true, .confidence = 0.999, .fault_rate = 0.5};
+    auto report = check_satisfiability<BlueprintFieldType>(bp, table, options);
+    EXPECT_TRUE(report.is_satisfied());
+    EXPECT_EQ(report.rows_checked, satisfiability_sample_size(0.999, 0.5));
+
+    // Every other row is broken, the sample of 10 rows misses all of them with probability 1e-3
+    for (std::size_t row = 0; row < rows; row += 2) {
+        table.witness(3, row) += value_type::one();
+    }
+    for (std::uint64_t seed = 1; seed <= 5; seed++) {
+        auto seeded = options;
+        seeded.seed = seed;
+        report = check_satisfiability<BlueprintFieldType>(bp, table, seeded);
+        EXPECT_FALSE(report.is_satisfied()) << "seed " << seed;
+        EXPECT_LT(report.rows_checked, rows);
+    }
+}
@@ -0,0 +1,156 @@
+#include "daemon.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/json/parse.hpp>
+#include <filesystem>
+#include <memory>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <string>
+
+namespace {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+
+    boost::json::object response_object(const httplib::Response& res) {
+        return boost::json::parse(res.body).as_object();
+    }
+}  // namespace
+
+class assigner_daemon_test : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() {
+        work_directory = ::testing::TempDir() + "assigner_daemon_jobs";
+        std::filesystem::create_directories(work_directory);
+        const auto options = std::filesystem::copy_options::overwrite_existing;
+        std::filesystem::copy_file(BLOCK_CONFIG, work_directory + "/block.json", options);
+        std::filesystem::copy_file(STATE_CONFIG, work_directory + "/state.json", options);
+
+        daemon_options opts;
+        opts.work_directory = work_directory;
+        daemon = std::make_unique<assigner_daemon<BlueprintFieldType>>(
+            opts, 0 /*shard id*/, std::vector<std::string>{}, false, boost::log::trivial::info);
+        ASSERT_FALSE(daemon->init().has_value());
+    }
+
+    static void TearDownTestSuite() { daemon.reset(); }
+
+    static httplib::Response post_job(const std::string& body) {
+        httplib::Request req;
+        req.body = body;
+        httplib::Response res;
+        daemon->handle_job(req, res);
+        return res;
+    }
+
+    static std::string work_directory;
+    static std::unique_ptr<assigner_daemon<BlueprintFieldType>> daemon;
+};
+
+std::string assigner_daemon_test::work_directory;
+std::unique_ptr<assigner_daemon<BlueprintFieldType>> assigner_daemon_test::daemon;
+
+TEST_F(assigner_daemon_test, rejects_malformed_jobs) {
+    auto res = post_job("not a json");
+    EXPECT_EQ(res.status, 400);
+    EXPECT_TRUE(response_object(res).contains("error"));
+
+    res = post_job(R"({"assignment_tables": "out"})");
+    EXPECT_EQ(res.status, 400);
+
+    res = post_job(R"({"block_file": "block.json"})");
+    EXPECT_EQ(res.status, 400);
+
+    res = post_job(R"({"block_file": 1, "assignment_tables": "out"})");
+    EXPECT_EQ(res.status, 400);
+}
+
+TEST_F(assigner_daemon_test, rejects_paths_outside_work_directory) {
+    for (const auto* body :
+         {R"({"block_file": "/etc/passwd", "assignment_tables": "out"})",
+          R"({"block_file": "../block.json", "assignment_tables": "out"})",
+          R"({"block_file": "block.json", "assignment_tables": "../out"})",
+          R"({"block_file": "block.json", "assignment_tables": "."})",
+          R"({"block_file": "block.json", "assignment_tables": "out", "profile": "/tmp/p"})"}) {
+        const auto res = post_job(body);
+        EXPECT_EQ(res.status, 400) << body;
+        EXPECT_TRUE(response_object(res).contains("error")) << body;
+    }
+    EXPECT_FALSE(std::filesystem::exists(work_directory + "/../out.0"));
+}
+
+TEST_F(assigner_daemon_test, runs_job) {
+    const auto completed = daemon->metrics().at("jobs_completed").as_uint64();
+    const auto res = post_job(
+        R"({"block_file": "block.json", "account_storage": "state.json",)"
+        R"( "assignment_tables": "out", "profile": "profile.json"})");
+    const auto response = response_object(res);
+    ASSERT_TRUE(response.contains("status")) << res.body;
+    EXPECT_EQ(response.at("status").as_string(), "ok");
+    EXPECT_TRUE(response.contains("satisfied"));
+    EXPECT_TRUE(response.contains("duration_ms"));
+    EXPECT_TRUE(std::filesystem::exists(work_directory + "/profile.json"));
+    EXPECT_EQ(daemon->metrics().at("jobs_completed").as_uint64(), completed + 1);
+}
+
+TEST_F(assigner_daemon_test, reports_failed_job) {
+    const auto failed = daemon->metrics().at("jobs_failed").as_uint64();
+    const auto res = post_job(R"({"block_file": "missing.json", "assignment_tables": "out"})");
+    EXPECT_EQ(res.status, 500);
+    EXPECT_TRUE(response_object(res).contains("error"));
+    EXPECT_EQ(daemon->metrics().at("jobs_failed").as_uint64(), failed + 1);
+}
+
+TEST(assigner_daemon_options_test, applies_max_rows) {
+    const std::string work_directory = ::testing::TempDir() + "assigner_daemon_max_rows";
+    std::filesystem::create_directories(work_directory);
+    const auto copy_options = std::filesystem::copy_options::overwrite_existing;
+    std::filesystem::copy_file(BLOCK_CONFIG, work_directory + "/block.json", copy_options);
+    std::filesystem::copy_file(STATE_CONFIG, work_directory + "/state.json", copy_options);
+
+    daemon_options opts;
+    opts.work_directory = work_directory;
+    opts.max_rows = 1;
+    assigner_daemon<BlueprintFieldType> daemon(opts, 0 /*shard id*/, {}, false,
+                                               boost::log::trivial::info);
+    ASSERT_FALSE(daemon.init().has_value());
+
+    httplib::Request req;
+    req.body =
+        R"({"block_file": "block.json", "account_storage": "state.json",)"
+        R"( "assignment_tables": "out"})";
+    httplib::Response res;
+    daemon.handle_job(req, res);
+    EXPECT_EQ(res.status, 500);
+    const auto response = response_object(res);
+    ASSERT_TRUE(response.contains("error")) << res.body;
+    EXPECT_NE(std::string(response.at("error").as_string().c_str()).find("limit is 1"),
+              std::string::npos)
+        << res.body;
+}
+
+TEST(assigner_daemon_shutdown_test, requires_token) {
+    auto shutdown = [](assigner_daemon<BlueprintFieldType>& daemon,
+                       const std::string& authorization) {
+        httplib::Request req;
+        if (!authorization.empty()) {
+            req.set_header("Authorization", authorization);
+        }
+        httplib::Response res;
+        daemon.handle_shutdown(req, res);
+        return res.status;
+    };
+
+    daemon_options opts;
+    opts.shutdown_token = "secret";
+    assigner_daemon<BlueprintFieldType> daemon(opts, 0 /*shard id*/, {}, false,
+                                               boost::log::trivial::info);
+    EXPECT_EQ(shutdown(daemon, ""), 403);
+    EXPECT_EQ(shutdown(daemon, "Bearer wrong"), 403);
+    EXPECT_NE(shutdown(daemon, "Bearer secret"), 403);
+
+    // Without a token shutdown requests are always rejected
+    assigner_daemon<BlueprintFieldType> tokenless(daemon_options{}, 0 /*shard id*/, {}, false,
+                                                  boost::log::trivial::info);
+    EXPECT_EQ(shutdown(tokenless, ""), 403);
+    EXPECT_EQ(shutdown(tokenless, "Bearer "), 403);
+}
@@ -0,0 +1,113 @@
+#include "zkevm_framework/assigner_runner/block_roots.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ssz++.hpp>
+#include <string>
+#include <vector>
+
+#include "zkevm_framework/core/mpt/mpt.hpp"
+
+namespace {
+    std::vector<core::types::Message> make_messages(std::size_t count) {
+        std::vector<core::types::Message> messages(count);
+        for (std::size_t i = 0; i < count; i++) {
+            messages[i].m_seqno = i;
+            messages[i].m_to = {std::byte(i % 256)};
+            messages[i].m_data = {{std::vector<std::byte>(i % 64, std::byte{0xDD})}};
+        }
+        return messages;
+    }
+}  // namespace
+
+TEST(block_roots_test, in_messages_trie_root) {
+    constexpr std::size_t count = 1000;
+    const input_messages parsed(make_messages(count));
+
+    // Reference trie filled by sequential insertion
+    core::mpt::MerklePatriciaTrie trie;
+    std::vector<std::byte> bytes;
+    std::vector<std::size_t> ends;
+    for (const auto& message : make_messages(count)) {
+        const auto encoded = ssz::serialize(message);
+        trie.set(ssz::serialize(static_cast<std::uint64_t>(ends.size())), encoded);
+        bytes.insert(bytes.end(), encoded.begin(), encoded.end());
+        ends.push_back(bytes.size());
+    }
+    core::Hash expected{};
+    std::copy(trie.root().begin(), trie.root().end(), expected.begin());
+
+    EXPECT_EQ(in_messages_trie_root(parsed, 1), expected);
+    EXPECT_EQ(in_messages_trie_root(parsed, 8), expected);
+
+    input_messages serialized;
+    ASSERT_FALSE(serialized.assign_serialized(std::move(bytes), ends));
+    EXPECT_EQ(in_messages_trie_root(serialized, 4), expected);
+
+    EXPECT_NE(in_messages_trie_root(input_messages(make_messages(count - 1))), expected);
+    EXPECT_EQ(in_messages_trie_root(input_messages{}), core::Hash{});
+}
+
+TEST(block_roots_test, compute_block_roots) {
+    constexpr std::size_t count = 100;
+    core::types::Block block{};
+    block.m_id = 7;
+    const input_messages parsed(make_messages(count));
+    const auto roots = compute_block_roots(block, parsed, 1);
+    EXPECT_EQ(compute_block_roots(block, parsed, 3), roots);
+
+    std::vector<std::byte> bytes;
+    std::vector<std::size_t> ends;
+    for (const auto& message : make_messages(count)) {
+        const auto encoded = ssz::serialize(message);
+        bytes.insert(bytes.end(), encoded.begin(), encoded.end());
+        ends.push_back(bytes.size());
+    }
+    input_messages serialized;
+    ASSERT_FALSE(serialized.assign_serialized(std::move(bytes), ends));
+    EXPECT_EQ(compute_block_roots(block, serialized, 4), roots);
+
+    const auto fewer = compute_block_roots(block, input_messages(make_messages(count - 1)));
+    EXPECT_EQ(fewer.block, roots.block);
+    EXPECT_NE(fewer.in_messages, roots.in_messages);
+    block.m_id++;
+    EXPECT_NE(compute_block_roots(block, parsed).block, roots.block);
+}
+
+TEST(block_roots_test, json) {
+    std::vector<block_roots> roots(3);
+    for (std::size_t i = 0; i < roots.size(); i++) {
+        roots[i].block[0] = static_cast<std::byte>(i);
+        roots[i].block[31] = std::byte{0xAB};
+        roots[i].in_messages[1] = static_cast<std::byte>(0xF0 + i);
+    }
+    std::vector<block_roots> parsed;
+    ASSERT_FALSE(block_roots_from_json(block_roots_to_json(roots), parsed));
+    EXPECT_EQ(parsed, roots);
+
+    ASSERT_FALSE(block_roots_from_json(block_roots_to_json({}), parsed));
+    EXPECT_TRUE(parsed.empty());
+
+    const std::string zero(64, '0');
+    // Prefix is optional
+    ASSERT_FALSE(block_roots_from_json(
+        R"({"blocks":[{"block":")" + zero + R"(","in_messages":"0x)" + zero + R"("}]})",
+        parsed));
+    ASSERT_EQ(parsed.size(), 1);
+    EXPECT_EQ(parsed[0], block_roots{});
+
+    EXPECT_TRUE(block_roots_from_json("not json", parsed));
+    EXPECT_TRUE(block_roots_from_json(R"({"roots":[]})", parsed));
+    EXPECT_TRUE(block_roots_from_json(R"({"blocks":[{"block":"0x)" + zero + R"("}]})", parsed));
+    // Short, not hex and not string roots
+    EXPECT_TRUE(block_roots_from_json(
+        R"({"blocks":[{"block":"0x00","in_messages":"0x)" + zero + R"("}]})", parsed));
+    EXPECT_TRUE(block_roots_from_json(R"({"blocks":[{"block":"0x)" + std::string(64, 'z') +
+                                          R"(","in_messages":"0x)" + zero + R"("}]})",
+                                      parsed));
+    EXPECT_TRUE(block_roots_from_json(
+        R"({"blocks":[{"block":1,"in_messages":"0x)" + zero + R"("}]})", parsed));
+}
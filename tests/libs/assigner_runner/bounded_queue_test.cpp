@@ -0,0 +1,53 @@
+#include "zkevm_framework/assigner_runner/bounded_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(bounded_queue_test, keeps_order) {
+    bounded_queue<int> queue(4, 100);
+    std::thread producer([&] {
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_TRUE(queue.push(i, 10));
+        }
+        queue.finish();
+    });
+    std::vector<int> received;
+    while (auto item = queue.pop()) {
+        received.push_back(*item);
+    }
+    producer.join();
+    ASSERT_EQ(received.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(received[i], i);
+    }
+}
+
+TEST(bounded_queue_test, byte_budget) {
+    bounded_queue<int> queue(10, 100);
+    ASSERT_TRUE(queue.push(0, 500));  // Oversized item is accepted by empty queue
+
+    std::atomic<bool> pushed = false;
+    std::thread producer([&] {
+        queue.push(1, 60);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(pushed);  // Blocked by budget
+    ASSERT_EQ(queue.pop(), 0);
+    producer.join();
+    ASSERT_TRUE(pushed);
+    ASSERT_EQ(queue.bytes(), 60);
+}
+
+TEST(bounded_queue_test, close_releases_waiters) {
+    bounded_queue<int> queue(1, 100);
+    ASSERT_TRUE(queue.push(0));
+    std::thread producer([&] { ASSERT_FALSE(queue.push(1)); });
+    queue.close();
+    producer.join();
+    ASSERT_FALSE(queue.pop().has_value());
+    ASSERT_FALSE(queue.push(2));
+}
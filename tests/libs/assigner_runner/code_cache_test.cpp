@@ -0,0 +1,26 @@
+#include "zkevm_framework/assigner_runner/code_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+TEST(code_cache_test, shares_code_by_hash) {
+    code_cache cache;
+    const std::vector<uint8_t> code{0x60, 0x01, 0x60, 0x02, 0x01, 0x00};
+    const auto first = cache.get(code);
+    const auto second = cache.get(std::vector<uint8_t>(code));
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_EQ(cache.hits(), 1);
+    ASSERT_EQ(cache.misses(), 1);
+    ASSERT_EQ(std::vector<uint8_t>(first->data(), first->data() + first->size()), code);
+    ASSERT_EQ(cache.find(first->hash()), first);
+
+    const auto other = cache.get(std::vector<uint8_t>{0x00});
+    ASSERT_NE(other, first);
+    ASSERT_EQ(cache.size(), 2);
+
+    const auto empty = cache.get({});
+    ASSERT_EQ(empty->size(), 0);
+}
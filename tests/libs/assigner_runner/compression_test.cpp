@@ -0,0 +1,86 @@
+#include "zkevm_framework/assigner_runner/compression.hpp"
+
+#include <gtest/gtest.h>
+
+#include <istream>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    // Mostly zeros with some random bytes, like padded assignment tables
+    std::string table_like_data(std::size_t size) {
+        std::mt19937 rng(42);
+        std::string data(size, '\0');
+        for (std::size_t i = 0; i < size; i += 1 + rng() % 64) {
+            data[i] = static_cast<char>(rng());
+        }
+        return data;
+    }
+}  // namespace
+
+TEST(compression_test, parse_options) {
+    auto options = compression_options::parse("zstd:19");
+    ASSERT_TRUE(options.has_value());
+    EXPECT_EQ(options->codec, compression_codec::zstd);
+    EXPECT_EQ(options->level, 19);
+    options = compression_options::parse("gzip");
+    ASSERT_TRUE(options.has_value());
+    EXPECT_EQ(options->codec, compression_codec::gzip);
+    EXPECT_EQ(options->level, 0);
+    EXPECT_FALSE(compression_options::parse("lzma").has_value());
+    EXPECT_FALSE(compression_options::parse("gzip:10").has_value());
+    EXPECT_FALSE(compression_options::parse("zstd:x").has_value());
+}
+
+TEST(compression_test, roundtrip) {
+    const auto data = table_like_data(1 << 20);
+    for (auto codec : {compression_codec::none, compression_codec::gzip, compression_codec::zstd}) {
+        compression_options options{.codec = codec, .chunk_size = 100000, .threads = 4};
+        const auto compressed = compress_chunked(data, options);
+        if (codec != compression_codec::none) {
+            EXPECT_LT(compressed.size(), data.size() / 2);
+        }
+
+        std::istringstream in(compressed);
+        chunked_decompressor reader;
+        auto err = reader.open(in);
+        ASSERT_FALSE(err.has_value()) << err.value();
+        EXPECT_EQ(reader.codec(), codec);
+        EXPECT_EQ(reader.size(), data.size());
+        EXPECT_EQ(reader.chunks_amount(), 11);
+
+        std::string part;
+        ASSERT_FALSE(reader.read(99990, 200020, part).has_value());
+        EXPECT_EQ(part, data.substr(99990, 200020));
+
+        chunked_decompress_buf buf(reader);
+        std::istream stream(&buf);
+        std::string all((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        EXPECT_FALSE(buf.error().has_value());
+        EXPECT_EQ(all, data);
+    }
+}
+
+TEST(compression_test, empty) {
+    const auto compressed = compress_chunked("", {.codec = compression_codec::zstd});
+    std::istringstream in(compressed);
+    chunked_decompressor reader;
+    ASSERT_FALSE(reader.open(in).has_value());
+    EXPECT_EQ(reader.size(), 0);
+    EXPECT_EQ(reader.chunks_amount(), 0);
+}
+
+TEST(compression_test, broken_file) {
+    auto compressed = compress_chunked(table_like_data(10000), {.codec = compression_codec::zstd,
+                                                                .chunk_size = 1000});
+    std::istringstream truncated(compressed.substr(1));
+    chunked_decompressor reader;
+    EXPECT_TRUE(reader.open(truncated).has_value());
+
+    compressed[0] ^= 0x55;
+    std::istringstream in(compressed);
+    ASSERT_FALSE(reader.open(in).has_value());
+    std::string chunk;
+    EXPECT_TRUE(reader.read_chunk(0, chunk).has_value());
+}
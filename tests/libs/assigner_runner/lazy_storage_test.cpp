@@ -0,0 +1,121 @@
+#include "zkevm_framework/assigner_runner/lazy_storage.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace {
+    evmc::bytes32 make_slot(uint8_t v) {
+        evmc::bytes32 result{};
+        result.bytes[31] = v;
+        return result;
+    }
+
+    std::vector<std::byte> to_bytes(const evmc::bytes32& v) {
+        const auto* data = reinterpret_cast<const std::byte*>(v.bytes);
+        return std::vector<std::byte>(data, data + sizeof(v.bytes));
+    }
+
+    core::Hash to_hash(const core::mpt::Reference& ref) {
+        core::Hash result{};
+        std::copy_n(ref.begin(), result.size(), result.begin());
+        return result;
+    }
+}  // namespace
+
+TEST(lazy_storage_test, loads_slots_once) {
+    evmc::address addr{};
+    addr.bytes[19] = 1;
+    std::size_t requests = 0;
+    lazy_storage storage([&](const evmc::address&, const evmc::bytes32& key,
+                             evmc::bytes32& value) -> std::optional<std::string> {
+        ++requests;
+        value = make_slot(key.bytes[31] + 100);
+        return {};
+    });
+
+    evmc::bytes32 value;
+    ASSERT_TRUE(storage.get(addr, make_slot(1), value).has_value());  // Contract is not opened
+
+    storage.open_contract(addr, core::Hash{});
+    ASSERT_FALSE(storage.get(addr, make_slot(1), value).has_value());
+    ASSERT_EQ(value, make_slot(101));
+    ASSERT_FALSE(storage.get(addr, make_slot(1), value).has_value());
+    ASSERT_EQ(requests, 1);
+    ASSERT_TRUE(storage.is_loaded(addr, make_slot(1)));
+    ASSERT_FALSE(storage.is_loaded(addr, make_slot(2)));
+
+    // Root covers touched slots and follows writes
+    const auto root = storage.storage_root(addr);
+    ASSERT_NE(root, core::Hash{});
+    ASSERT_FALSE(storage.set(addr, make_slot(2), make_slot(7)).has_value());
+    ASSERT_EQ(requests, 2);  // Original value is loaded before write
+    ASSERT_NE(storage.storage_root(addr), root);
+    ASSERT_FALSE(storage.set(addr, make_slot(2), evmc::bytes32{}).has_value());
+    ASSERT_EQ(storage.storage_root(addr), root);
+    ASSERT_EQ(storage.loaded_slots(), 2);
+}
+
+TEST(lazy_storage_test, reads_from_storage_trie) {
+    core::mpt::MerklePatriciaTrie source;
+    for (uint8_t i = 1; i <= 100; ++i) {
+        source.set(to_bytes(make_slot(i)), to_bytes(make_slot(i + 1)));
+    }
+
+    evmc::address addr{};
+    addr.bytes[0] = 0xAA;
+    std::size_t loaded_nodes = 0;
+    lazy_storage storage(
+        [](const evmc::address&, const evmc::bytes32&,
+           evmc::bytes32&) -> std::optional<std::string> { return "Unexpected slot request"; },
+        [&](const core::mpt::Reference& ref) {
+            ++loaded_nodes;
+            return source.find_node(ref);
+        });
+    storage.open_contract(addr, to_hash(source.root()));
+
+    evmc::bytes32 value;
+    ASSERT_FALSE(storage.get(addr, make_slot(5), value).has_value());
+    ASSERT_EQ(value, make_slot(6));
+    ASSERT_FALSE(storage.get(addr, make_slot(200), value).has_value());
+    ASSERT_EQ(value, evmc::bytes32{});
+    ASSERT_GT(loaded_nodes, 0);
+    ASSERT_LT(loaded_nodes, 20);
+
+    // Post-block root is exact
+    ASSERT_FALSE(storage.set(addr, make_slot(5), make_slot(42)).has_value());
+    ASSERT_FALSE(storage.set(addr, make_slot(6), evmc::bytes32{}).has_value());
+    source.set(to_bytes(make_slot(5)), to_bytes(make_slot(42)));
+    source.remove(to_bytes(make_slot(6)));
+    ASSERT_EQ(storage.storage_root(addr), to_hash(source.root()));
+}
+
+TEST(lazy_storage_test, zeroes_last_slot) {
+    evmc::address addr{};
+    lazy_storage storage([&](const evmc::address&, const evmc::bytes32& key,
+                             evmc::bytes32& value) -> std::optional<std::string> {
+        value = key.bytes[31] == 1 ? make_slot(9) : evmc::bytes32{};
+        return {};
+    });
+    storage.open_contract(addr, core::Hash{});
+
+    // SSTORE 0 to the only loaded slot deletes the last key of the trie
+    ASSERT_FALSE(storage.set(addr, make_slot(1), evmc::bytes32{}).has_value());
+    ASSERT_EQ(storage.storage_root(addr), core::Hash{});
+    ASSERT_FALSE(storage.set(addr, make_slot(1), make_slot(3)).has_value());
+    ASSERT_NE(storage.storage_root(addr), core::Hash{});
+}
+
+TEST(lazy_storage_test, reports_load_failures) {
+    evmc::address addr{};
+    lazy_storage storage([](const evmc::address&, const evmc::bytes32&,
+                            evmc::bytes32&) -> std::optional<std::string> { return "timeout"; });
+    storage.open_contract(addr, core::Hash{});
+
+    evmc::bytes32 value;
+    ASSERT_TRUE(storage.get(addr, make_slot(1), value).has_value());
+    ASSERT_FALSE(storage.is_loaded(addr, make_slot(1)));
+    ASSERT_TRUE(storage.set(addr, make_slot(1), make_slot(2)).has_value());
+}
@@ -0,0 +1,86 @@
+#include "zkevm_framework/assigner_runner/profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST(profiler_test, records_scopes) {
+    profiler prof;
+    {
+        auto outer = prof.scope("outer");
+        auto inner = prof.scope("inner", "message");
+        inner.add_counter("gas", 42);
+    }
+    auto stopped = prof.scope("stopped");
+    stopped.stop();
+    stopped.stop();  // Second stop is no-op
+
+    profiler::scoped_timer disabled;
+    disabled.add_counter("gas", 1);
+    disabled.stop();
+
+    const auto events = prof.events();
+    ASSERT_EQ(events.size(), 3);
+    ASSERT_EQ(events[0].name, "inner");  // Inner scope is finished first
+    ASSERT_EQ(events[0].category, "message");
+    ASSERT_EQ(events[0].counters.at("gas"), 42);
+    ASSERT_EQ(events[1].name, "outer");
+    ASSERT_EQ(events[1].category, "phase");
+    ASSERT_LE(events[1].start, events[0].start);
+    ASSERT_EQ(events[2].name, "stopped");
+}
+
+TEST(profiler_test, per_thread_events) {
+    profiler prof;
+    auto main_scope = prof.scope("main");
+    std::thread worker([&prof] {
+        auto worker_scope = prof.scope("worker");
+        allocation_counter() += 1000;
+    });
+    worker.join();
+    allocation_counter() += 10;
+    main_scope.stop();
+
+    const auto events = prof.events();
+    ASSERT_EQ(events.size(), 2);
+    ASSERT_EQ(events[0].name, "worker");
+    ASSERT_EQ(events[0].allocated_bytes, 1000);
+    ASSERT_EQ(events[1].name, "main");
+    // Allocations of the worker are not counted by the scope of the main thread
+    ASSERT_EQ(events[1].allocated_bytes, 10);
+    ASSERT_NE(events[0].thread_id, events[1].thread_id);
+}
+
+TEST(profiler_test, dump_formats) {
+    ASSERT_EQ(profiler::parse_format("json"), profiler::output_format::json);
+    ASSERT_EQ(profiler::parse_format("chrome"), profiler::output_format::chrome);
+    ASSERT_FALSE(profiler::parse_format("xml").has_value());
+
+    profiler prof;
+    prof.scope("evaluate").add_counter("code_size", 10);
+
+    const std::string file_name = "profiler_test.json";
+    auto read_file = [&]() {
+        std::ifstream in(file_name);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    };
+
+    ASSERT_FALSE(prof.dump(file_name, profiler::output_format::json).has_value());
+    auto content = read_file();
+    ASSERT_NE(content.find("\"events\""), std::string::npos);
+    ASSERT_NE(content.find("\"code_size\":10"), std::string::npos);
+
+    ASSERT_FALSE(prof.dump(file_name, profiler::output_format::chrome).has_value());
+    content = read_file();
+    ASSERT_NE(content.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(content.find("\"ph\":\"X\""), std::string::npos);
+    std::remove(file_name.c_str());
+
+    ASSERT_TRUE(prof.dump("/nonexistent/dir/profile.json", profiler::output_format::json));
+}
@@ -0,0 +1,63 @@
+#include "zkevm_framework/assigner_runner/row_estimator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/utils.hpp"
+
+namespace {
+    core::types::Message make_message(std::uint8_t to, std::uint64_t fee_credit) {
+        core::types::Message msg;
+        msg.m_flags.set(std::size_t(core::types::MessageKind::Internal));
+        msg.m_to[core::types::ADDR_SIZE - 1] = std::byte{to};
+        msg.m_feeCredit.m_value = fee_credit;
+        return msg;
+    }
+
+    void add_contract(evmc::accounts& accounts, std::uint8_t addr, std::size_t code_size,
+                      std::uint8_t fill) {
+        core::types::Address address{};
+        address[core::types::ADDR_SIZE - 1] = std::byte{addr};
+        accounts[to_evmc_address(address)].code = evmc::bytes(code_size, fill);
+    }
+}  // namespace
+
+TEST(row_estimator_test, bytecode_rows) {
+    core::types::Block block;
+    block.m_gasPrice.m_value = 10;
+
+    evmc::accounts accounts;
+    add_contract(accounts, 1, 100, 0x60);
+    add_contract(accounts, 2, 100, 0x60);  // Same code as the first one
+    add_contract(accounts, 3, 30, 0x61);
+
+    const std::vector<core::types::Message> messages = {
+        make_message(1, 1000), make_message(2, 1000), make_message(3, 500),
+        make_message(4, 500)};  // Transfer to an account without code
+
+    row_estimator estimator;
+    const auto estimate = estimator.estimate(block, messages, accounts);
+    EXPECT_EQ(estimate.messages, 4);
+    EXPECT_EQ(estimate.contracts, 2);
+    EXPECT_EQ(estimate.code_bytes, 130);
+    EXPECT_EQ(estimate.gas, 300);
+    EXPECT_EQ(estimate.rows.at(nil::evm_assigner::zkevm_circuit::BYTECODE), 132);
+
+    EXPECT_FALSE(estimate.check_limit(132).has_value());
+    EXPECT_TRUE(estimate.check_limit(131).has_value());
+}
+
+TEST(row_estimator_test, custom_model) {
+    core::types::Block block;
+    block.m_gasPrice.m_value = 1;
+    const std::vector<core::types::Message> messages = {make_message(1, 1000),
+                                                        make_message(2, 3000)};
+
+    row_estimator estimator;
+    estimator.set_model(nil::evm_assigner::zkevm_circuit::BYTECODE,
+                        {.base = 8, .per_message = 2, .per_gas = 0.01});
+    const auto estimate = estimator.estimate(block, messages, evmc::accounts{});
+    EXPECT_EQ(estimate.rows.at(nil::evm_assigner::zkevm_circuit::BYTECODE), 8 + 4 + 40);
+}
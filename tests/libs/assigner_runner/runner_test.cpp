@@ -2,12 +2,24 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
 #include <boost/log/trivial.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
+#include "zkevm_framework/assigner_runner/lazy_storage.hpp"
+#include "zkevm_framework/assigner_runner/pipeline.hpp"
+#include "zkevm_framework/assigner_runner/utils.hpp"
 #include "zkevm_framework/preset/preset.hpp"
+#include "zkevm_framework/rpc/fixture_server.hpp"
 
 TEST(runner_test, check_block) {
     using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
@@ -39,3 +51,294 @@ TEST(runner_test, check_block) {
     ASSERT_EQ(assignments[1].witness(0, 1), 4);
     */
 }
+
+TEST(runner_test, pipeline_blocks) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+
+    zkevm_circuits<ArithmetizationType> circuits;
+
+    std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                       nil::blueprint::assignment<ArithmetizationType>>
+        assignments;
+
+    auto err = initialize_circuits<BlueprintFieldType>(circuits, assignments);
+    ASSERT_FALSE(err.has_value());
+    single_thread_runner<BlueprintFieldType> runner(assignments, 0 /*shad id*/,
+                                                    circuits.get_circuit_names());
+    err = runner.extract_accounts_with_storage(STATE_CONFIG);
+    ASSERT_FALSE(err.has_value());
+
+    const std::string basename = ::testing::TempDir() + "pipeline_assignments";
+    block_pipeline<BlueprintFieldType> pipeline(runner, {.memory_budget = 1 << 20});
+    err = pipeline.run({{.file_name = BLOCK_CONFIG}, {.file_name = BLOCK_CONFIG}}, basename,
+                       std::nullopt);
+    ASSERT_FALSE(err.has_value());
+
+    for (std::size_t block = 0; block < 2; ++block) {
+        for (const auto& [circuit, _] : assignments) {
+            const auto filename =
+                block_pipeline<BlueprintFieldType>::block_file_name(basename, block);
+            std::ifstream table(filename + "." + std::to_string(circuit));
+            EXPECT_TRUE(table.is_open());
+        }
+    }
+
+    err = pipeline.run({{.file_name = "missing_block.json"}}, basename, std::nullopt);
+    ASSERT_TRUE(err.has_value());
+}
+
+TEST(runner_test, lazy_storage_blocks) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using namespace evmc::literals;
+
+    zkevm_circuits<ArithmetizationType> circuits;
+
+    std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                       nil::blueprint::assignment<ArithmetizationType>>
+        assignments;
+
+    auto err = initialize_circuits<BlueprintFieldType>(circuits, assignments);
+    ASSERT_FALSE(err.has_value());
+    single_thread_runner<BlueprintFieldType> runner(assignments, 0 /*shad id*/,
+                                                    circuits.get_circuit_names());
+
+    core::types::Block block;
+    input_messages messages;
+    block_origin origin;
+    err = runner.load_block("", BLOCK_CONFIG, block, messages, origin);
+    ASSERT_FALSE(err.has_value());
+    const auto prev_block = to_str(block.m_prev_block);
+
+    // No state file is loaded: the counter contract called by the block and its slot come from
+    // node responses, the slot is 1 before the first block
+    const auto contract = 0x000121f6629fb5bd92c630f734ef5c03fa6fd286_address;
+    const evmc::bytes32 counter_slot{};
+    const auto fixtures_dir = std::filesystem::path(::testing::TempDir()) / "lazy_storage_rpc";
+    std::filesystem::create_directories(fixtures_dir);
+    {
+        std::ifstream state_file(STATE_CONFIG);
+        std::stringstream state;
+        state << state_file.rdbuf();
+        const auto account =
+            boost::json::parse(state.str()).at("accounts").as_array().at(0).as_object();
+        std::ofstream out(fixtures_dir / fixture_server::fixture_name(
+                                             "debug_getContract",
+                                             boost::json::array{to_str(contract), prev_block}));
+        out << boost::json::serialize(
+            boost::json::object{{"jsonrpc", "2.0"}, {"id", 1}, {"result", account}});
+    }
+    {
+        std::ofstream out(fixtures_dir /
+                          fixture_server::fixture_name(
+                              "eth_getStorageAt", boost::json::array{to_str(contract),
+                                                                     to_str(counter_slot),
+                                                                     prev_block}));
+        out << R"({"jsonrpc":"2.0","id":1,"result":"0x1"})";
+    }
+
+    fixture_server_options options;
+    options.fixtures_dir = fixtures_dir.string();
+    options.listen = {.host = "127.0.0.1", .port = 18529};
+    fixture_server server(options);
+    std::thread server_thread([&server] { server.run(); });
+    server.wait_until_ready();
+
+    runner.set_rpc_endpoint(options.listen);
+    runner.set_lazy_storage(true);
+    const std::string basename = ::testing::TempDir() + "lazy_storage_assignments";
+    block_pipeline<BlueprintFieldType> pipeline(runner, {});
+    err = pipeline.run({{.file_name = BLOCK_CONFIG}, {.file_name = BLOCK_CONFIG}}, basename,
+                       std::nullopt);
+    server.stop();
+    server_thread.join();
+    ASSERT_FALSE(err.has_value()) << *err;
+
+    // Both blocks increment the counter: the second one reads the slot written by the first
+    // instead of falling back to account storage, and nothing is requested again
+    EXPECT_EQ(server.hits(), 2);
+    const auto* storage = runner.get_lazy_storage();
+    ASSERT_NE(storage, nullptr);
+    ASSERT_TRUE(storage->has_contract(contract));
+    EXPECT_TRUE(storage->is_loaded(contract, counter_slot));
+
+    lazy_storage expected([](const evmc::address&, const evmc::bytes32&,
+                             evmc::bytes32& value) -> std::optional<std::string> {
+        value = {};
+        return {};
+    });
+    expected.open_contract(contract, core::Hash{});
+    evmc::bytes32 counter{};
+    counter.bytes[sizeof(counter.bytes) - 1] = 3;
+    ASSERT_FALSE(expected.set(contract, counter_slot, counter).has_value());
+    EXPECT_EQ(storage->storage_root(contract), expected.storage_root(contract));
+
+    std::filesystem::remove_all(fixtures_dir);
+}
+
+TEST(runner_test, block_roots) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+
+    zkevm_circuits<ArithmetizationType> circuits;
+
+    std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                       nil::blueprint::assignment<ArithmetizationType>>
+        assignments;
+
+    auto err = initialize_circuits<BlueprintFieldType>(circuits, assignments);
+    ASSERT_FALSE(err.has_value());
+    const auto preset_assignments = assignments;
+    // Runs the block with given expected roots, returns recorded roots
+    auto run_block = [&](std::optional<std::vector<block_roots>> expected,
+                         std::vector<block_roots>& recorded) {
+        assignments = preset_assignments;
+        single_thread_runner<BlueprintFieldType> runner(assignments, 0 /*shad id*/,
+                                                        circuits.get_circuit_names());
+        runner.set_record_block_roots(true);
+        if (expected) {
+            runner.set_expected_block_roots(std::move(*expected));
+        }
+        auto err = runner.extract_block_with_messages("", BLOCK_CONFIG);
+        EXPECT_FALSE(err.has_value());
+        err = runner.extract_accounts_with_storage(STATE_CONFIG);
+        EXPECT_FALSE(err.has_value());
+        err = runner.execute();
+        recorded = runner.get_block_roots();
+        return err;
+    };
+
+    std::vector<block_roots> roots;
+    err = run_block(std::nullopt, roots);
+    ASSERT_FALSE(err.has_value());
+    ASSERT_EQ(roots.size(), 1);
+
+    std::vector<block_roots> recorded;
+    err = run_block(roots, recorded);
+    ASSERT_FALSE(err.has_value());
+    EXPECT_EQ(recorded, roots);
+
+    auto changed = roots;
+    changed[0].block[0] ^= std::byte{1};
+    err = run_block(changed, recorded);
+    ASSERT_TRUE(err.has_value());
+    EXPECT_NE(err->find("Root of block 0"), std::string::npos) << *err;
+
+    changed = roots;
+    changed[0].in_messages[0] ^= std::byte{1};
+    err = run_block(changed, recorded);
+    ASSERT_TRUE(err.has_value());
+    EXPECT_NE(err->find("Root of input messages of block 0"), std::string::npos) << *err;
+
+    err = run_block(std::vector<block_roots>{}, recorded);
+    ASSERT_TRUE(err.has_value());
+    EXPECT_NE(err->find("No expected roots of block 0"), std::string::npos) << *err;
+}
+
+TEST(runner_test, messages_root) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+
+    zkevm_circuits<ArithmetizationType> circuits;
+
+    std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                       nil::blueprint::assignment<ArithmetizationType>>
+        assignments;
+
+    auto err = initialize_circuits<BlueprintFieldType>(circuits, assignments);
+    ASSERT_FALSE(err.has_value());
+    single_thread_runner<BlueprintFieldType> runner(assignments, 0 /*shad id*/,
+                                                    circuits.get_circuit_names());
+    err = runner.extract_accounts_with_storage(STATE_CONFIG);
+    ASSERT_FALSE(err.has_value());
+    runner.set_check_messages_root(true);
+
+    // Executes the block of the config as if it came from `origin`, `root` replaces its
+    // messages root
+    auto execute = [&](block_origin origin, std::optional<core::Hash> root) {
+        core::types::Block block;
+        input_messages messages;
+        block_origin loaded_origin;
+        auto err = runner.load_block("", BLOCK_CONFIG, block, messages, loaded_origin);
+        EXPECT_FALSE(err.has_value());
+        EXPECT_EQ(loaded_origin, block_origin::json_file);
+        EXPECT_FALSE(messages.empty());
+        if (root) {
+            block.m_in_messages_root = *root;
+        }
+        typename single_thread_runner<BlueprintFieldType>::assignments_type tables;
+        return runner.execute_block(std::move(block), std::move(messages), origin, tables);
+    };
+
+    // Blocks of JSON files are not checked
+    EXPECT_FALSE(execute(block_origin::json_file, std::nullopt).has_value());
+    EXPECT_FALSE(execute(block_origin::json_file, core::Hash{{std::byte{1}}}).has_value());
+
+    // Other blocks are checked whatever their root is, zero one included
+    for (const auto& root : {core::Hash{}, core::Hash{{std::byte{1}}}}) {
+        err = execute(block_origin::rpc, root);
+        ASSERT_TRUE(err.has_value());
+        EXPECT_NE(err->find("Root of input messages is"), std::string::npos) << *err;
+    }
+
+    core::types::Block block;
+    input_messages messages;
+    block_origin origin;
+    err = runner.load_block("", BLOCK_CONFIG, block, messages, origin);
+    ASSERT_FALSE(err.has_value());
+    EXPECT_FALSE(execute(block_origin::rpc, in_messages_trie_root(messages)).has_value());
+
+    runner.set_check_messages_root(false);
+    EXPECT_FALSE(execute(block_origin::rpc, core::Hash{}).has_value());
+}
+
+// Messages roots of real node blocks recorded by rpc_fixture_server. The directory of fixtures
+// is given by ZKEVM_RECORDED_BLOCKS, its blocks.txt has the shard id on the first line and hashes
+// of the recorded blocks on the following ones
+TEST(runner_test, messages_root_of_recorded_blocks) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+
+    const char* recorded = std::getenv("ZKEVM_RECORDED_BLOCKS");
+    if (recorded == nullptr) {
+        GTEST_SKIP() << "ZKEVM_RECORDED_BLOCKS is not set";
+    }
+    const std::filesystem::path fixtures_dir(recorded);
+    std::ifstream list(fixtures_dir / "blocks.txt");
+    ASSERT_TRUE(list.is_open()) << fixtures_dir / "blocks.txt";
+    std::uint64_t shard_id = 0;
+    ASSERT_TRUE(list >> shard_id);
+    std::vector<std::string> hashes;
+    for (std::string hash; list >> hash;) {
+        hashes.push_back(hash);
+    }
+    ASSERT_FALSE(hashes.empty());
+
+    fixture_server_options options;
+    options.fixtures_dir = fixtures_dir.string();
+    options.listen = {.host = "127.0.0.1", .port = 18530};
+    fixture_server server(options);
+    std::thread server_thread([&server] { server.run(); });
+    server.wait_until_ready();
+
+    typename single_thread_runner<BlueprintFieldType>::assignments_type assignments;
+    single_thread_runner<BlueprintFieldType> runner(assignments, shard_id);
+    runner.set_rpc_endpoint(options.listen);
+    for (const auto& hash : hashes) {
+        core::types::Block block;
+        input_messages messages;
+        block_origin origin;
+        const auto err = runner.load_block(hash, "", block, messages, origin);
+        EXPECT_FALSE(err.has_value()) << hash << ": " << *err;
+        if (!err) {
+            EXPECT_EQ(origin, block_origin::rpc);
+            EXPECT_EQ(in_messages_trie_root(messages), block.m_in_messages_root) << hash;
+        }
+    }
+    server.stop();
+    server_thread.join();
+}
@@ -0,0 +1,76 @@
+#include "zkevm_framework/assigner_runner/spilled_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <string>
+
+#include "zkevm_framework/assigner_runner/table_digest.hpp"
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+
+namespace {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using Endianness = nil::marshalling::option::big_endian;
+    using value_type = typename BlueprintFieldType::value_type;
+
+    nil::blueprint::assignment<ArithmetizationType> make_table() {
+        nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc(2, 1, 1, 1);
+        nil::blueprint::assignment<ArithmetizationType> table(desc);
+        for (std::size_t row = 0; row < 300; row++) {
+            table.witness(0, row) = value_type(row * row);
+            table.selector(0, row) = value_type(row % 2);
+        }
+        // Columns of different sizes
+        table.witness(1, 10) = value_type(42);
+        table.public_input(0, 0) = value_type(7);
+        return table;
+    }
+
+    std::string serialize(const auto& table, table_format format) {
+        std::ostringstream out(std::ios_base::binary | std::ios_base::out);
+        write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+            table, 0, usable_rows(table), out, format);
+        return std::move(out).str();
+    }
+}  // namespace
+
+TEST(spilled_table_test, columns) {
+    spilled_table<Endianness, ArithmetizationType> spilled;
+    ASSERT_FALSE(spilled_table<Endianness, ArithmetizationType>::spill(
+        make_table(), std::filesystem::temp_directory_path().string(), spilled));
+
+    const auto table = make_table();
+    ASSERT_EQ(spilled.witnesses_amount(), table.witnesses_amount());
+    ASSERT_EQ(spilled.selectors_amount(), table.selectors_amount());
+    EXPECT_EQ(usable_rows(spilled), usable_rows(table));
+    EXPECT_EQ(spilled.witness_column_size(1), table.witness_column_size(1));
+    EXPECT_EQ(spilled.public_input_column_size(0), table.public_input_column_size(0));
+    for (std::size_t row = 0; row < 300; row++) {
+        EXPECT_EQ(spilled.witness(0)[row], table.witness(0, row));
+        EXPECT_EQ(spilled.selector(0)[row], table.selector(0, row));
+    }
+    EXPECT_EQ(spilled.witness(1)[10], value_type(42));
+    EXPECT_EQ(spilled.public_input(0)[0], value_type(7));
+}
+
+TEST(spilled_table_test, same_output) {
+    spilled_table<Endianness, ArithmetizationType> spilled;
+    ASSERT_FALSE(spilled_table<Endianness, ArithmetizationType>::spill(
+        make_table(), std::filesystem::temp_directory_path().string(), spilled));
+
+    const auto table = make_table();
+    EXPECT_EQ(serialize(spilled, table_format::plain), serialize(table, table_format::plain));
+    EXPECT_EQ(serialize(spilled, table_format::compact), serialize(table, table_format::compact));
+    EXPECT_EQ(compute_table_digest<BlueprintFieldType>(spilled, {.chunk_rows = 64}).digest,
+              compute_table_digest<BlueprintFieldType>(table, {.chunk_rows = 64}).digest);
+}
+
+TEST(spilled_table_test, missing_directory) {
+    spilled_table<Endianness, ArithmetizationType> spilled;
+    EXPECT_TRUE(spilled_table<Endianness, ArithmetizationType>::spill(
+        make_table(), "/nonexistent/spill", spilled));
+}
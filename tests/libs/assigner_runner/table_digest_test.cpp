@@ -0,0 +1,65 @@
+#include "zkevm_framework/assigner_runner/table_digest.hpp"
+
+#include <gtest/gtest.h>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+
+namespace {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using value_type = typename BlueprintFieldType::value_type;
+
+    nil::blueprint::assignment<ArithmetizationType> make_table() {
+        nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc(2, 1, 1, 1);
+        nil::blueprint::assignment<ArithmetizationType> table(desc);
+        for (std::size_t row = 0; row < 1000; row++) {
+            table.witness(0, row) = value_type(row);
+            table.witness(1, row) = value_type(row * 7);
+            table.selector(0, row) = value_type(row % 2);
+        }
+        table.constant(0, 0) = value_type(1);
+        return table;
+    }
+}  // namespace
+
+TEST(table_digest_test, same_tables) {
+    const auto digest = compute_table_digest<BlueprintFieldType>(make_table(), {.chunk_rows = 64});
+    EXPECT_EQ(digest.usable_rows, 1000);
+    ASSERT_EQ(digest.columns.size(), 5);
+    EXPECT_EQ(digest.columns[0].name, "witness0");
+    EXPECT_EQ(digest.columns[4].name, "selector0");
+    EXPECT_EQ(digest.columns[0].chunks.size(), 16);
+
+    const auto single_thread = compute_table_digest<BlueprintFieldType>(
+        make_table(), {.chunk_rows = 64, .threads = 1});
+    EXPECT_EQ(digest.digest, single_thread.digest);
+    EXPECT_TRUE(digest.compare(single_thread).empty());
+}
+
+TEST(table_digest_test, report_differences) {
+    const auto expected =
+        compute_table_digest<BlueprintFieldType>(make_table(), {.chunk_rows = 100});
+    auto table = make_table();
+    table.witness(1, 150) = value_type(0);
+    table.witness(1, 250) = value_type(0);
+    table.witness(1, 950) = value_type(0);
+    const auto digest = compute_table_digest<BlueprintFieldType>(table, {.chunk_rows = 100});
+
+    const auto differences = digest.compare(expected);
+    ASSERT_EQ(differences.size(), 1);
+    EXPECT_EQ(differences[0], "witness1: rows 100-299, 900-999");
+}
+
+TEST(table_digest_test, manifest_roundtrip) {
+    const auto digest = compute_table_digest<BlueprintFieldType>(make_table());
+    table_digest parsed;
+    auto err = table_digest::from_json(digest.to_json(1), parsed);
+    ASSERT_FALSE(err.has_value()) << err.value();
+    EXPECT_EQ(parsed.digest, digest.digest);
+    EXPECT_EQ(parsed.chunk_rows, digest.chunk_rows);
+    EXPECT_TRUE(digest.compare(parsed).empty());
+
+    EXPECT_TRUE(table_digest::from_json("{}", parsed).has_value());
+    EXPECT_TRUE(table_digest::from_json("not json", parsed).has_value());
+}
@@ -0,0 +1,139 @@
+#include "zkevm_framework/assigner_runner/text_export.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <cstddef>
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <string>
+
+namespace {
+    // Mimics assignment::export_table: header line followed by selected rows
+    struct fake_table {
+        std::size_t rows;
+
+        std::size_t max_size() const { return rows; }
+
+        void export_table(std::ostream& os, const Ranges::ConcreteRanges& witnesses,
+                          const Ranges::ConcreteRanges&, const Ranges::ConcreteRanges&,
+                          const Ranges::ConcreteRanges&,
+                          const Ranges::ConcreteRanges& selected_rows) const {
+            os << "witnesses_size: " << witnesses.size() << " max_size: " << rows << "\n";
+            auto print_row = [&](std::size_t row) {
+                for (const auto& [first, last] : witnesses) {
+                    for (std::size_t column = first; column <= last; ++column) {
+                        os << std::hex << row * 31 + column << " ";
+                    }
+                }
+                os << "\n";
+            };
+            if (selected_rows.empty()) {
+                for (std::size_t row = 0; row < rows; ++row) {
+                    print_row(row);
+                }
+            }
+            for (const auto& [first, last] : selected_rows) {
+                for (std::size_t row = first; row <= last; ++row) {
+                    print_row(row);
+                }
+            }
+        }
+    };
+
+    // Header depends on the rows selection, so it can't be cut off blocks
+    struct counting_table : fake_table {
+        void export_table(std::ostream& os, const Ranges::ConcreteRanges& witnesses,
+                          const Ranges::ConcreteRanges& public_inputs,
+                          const Ranges::ConcreteRanges& constants,
+                          const Ranges::ConcreteRanges& selectors,
+                          const Ranges::ConcreteRanges& selected_rows) const {
+            os << "ranges: " << selected_rows.size() << "\n";
+            fake_table::export_table(os, witnesses, public_inputs, constants, selectors,
+                                     selected_rows);
+        }
+    };
+
+    template<typename TableType>
+    std::string serial(const TableType& table, const Ranges::ConcreteRanges& witnesses,
+                       const Ranges::ConcreteRanges& rows) {
+        std::ostringstream out;
+        table.export_table(out, witnesses, {}, {}, {}, rows);
+        return out.str();
+    }
+
+    template<typename TableType>
+    std::string parallel(const TableType& table, const Ranges::ConcreteRanges& witnesses,
+                         const Ranges::ConcreteRanges& rows, const text_export_options& options) {
+        std::ostringstream out;
+        export_table_parallel(table, out, witnesses, {}, {}, {}, rows, options);
+        return out.str();
+    }
+}  // namespace
+
+TEST(text_export_test, same_as_serial) {
+    const fake_table table{.rows = 1000};
+    const Ranges::ConcreteRanges witnesses = {{0, 2}, {5, 5}};
+    const text_export_options options{.block_rows = 7, .threads = 4};
+    EXPECT_EQ(parallel(table, witnesses, {}, options), serial(table, witnesses, {}));
+    const Ranges::ConcreteRanges rows = {{3, 100}, {50, 60}, {999, 999}};
+    EXPECT_EQ(parallel(table, witnesses, rows, options), serial(table, witnesses, rows));
+}
+
+TEST(text_export_test, gzip) {
+    const fake_table table{.rows = 500};
+    const Ranges::ConcreteRanges witnesses = {{0, 3}};
+    const auto compressed =
+        parallel(table, witnesses, {}, {.block_rows = 16, .threads = 3, .gzip = true});
+
+    // Members of all blocks are decompressed as one stream
+    std::istringstream in(compressed);
+    boost::iostreams::filtering_istream gz;
+    gz.push(boost::iostreams::gzip_decompressor());
+    gz.push(in);
+    std::ostringstream text;
+    boost::iostreams::copy(gz, text);
+    EXPECT_EQ(text.str(), serial(table, witnesses, {}));
+}
+
+TEST(text_export_test, header_depending_on_rows) {
+    const counting_table table{{.rows = 100}};
+    const Ranges::ConcreteRanges witnesses = {{0, 1}};
+    const text_export_options options{.block_rows = 8, .threads = 2};
+    EXPECT_EQ(parallel(table, witnesses, {}, options), serial(table, witnesses, {}));
+    const Ranges::ConcreteRanges rows = {{3, 50}, {60, 99}};
+    EXPECT_EQ(parallel(table, witnesses, rows, options), serial(table, witnesses, rows));
+}
+
+TEST(text_export_test, same_as_assignment_export) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using value_type = typename BlueprintFieldType::value_type;
+
+    // Header length is derived from the output of assignment::export_table
+    nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc(2, 1, 1, 1);
+    nil::blueprint::assignment<ArithmetizationType> table(desc);
+    for (std::size_t row = 0; row < 300; row++) {
+        table.witness(0, row) = value_type(row);
+        table.witness(1, row) = value_type(row * 7);
+        table.selector(0, row) = value_type(row % 2);
+    }
+    table.constant(0, 0) = value_type(1);
+
+    const Ranges::ConcreteRanges witnesses = {{0, 1}};
+    const Ranges::ConcreteRanges constants = {{0, 0}};
+    const Ranges::ConcreteRanges selectors = {{0, 0}};
+    const text_export_options options{.block_rows = 16, .threads = 3};
+    for (const Ranges::ConcreteRanges& rows :
+         {Ranges::ConcreteRanges{}, Ranges::ConcreteRanges{{5, 120}, {200, 299}}}) {
+        std::ostringstream expected;
+        table.export_table(expected, witnesses, {}, constants, selectors, rows);
+        std::ostringstream actual;
+        export_table_parallel(table, actual, witnesses, {}, constants, selectors, rows, options);
+        EXPECT_EQ(actual.str(), expected.str());
+    }
+}
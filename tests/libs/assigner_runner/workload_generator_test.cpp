@@ -0,0 +1,67 @@
+#include "zkevm_framework/assigner_runner/workload_generator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/block_parser.hpp"
+#include "zkevm_framework/assigner_runner/state_parser.hpp"
+#include "zkevm_framework/assigner_runner/utils.hpp"
+
+TEST(workload_generator_test, contract_mix) {
+    auto mix = workload_options::parse_contract_mix("counter:2,hasher");
+    ASSERT_TRUE(mix.has_value());
+    EXPECT_EQ(mix.value()[static_cast<std::size_t>(workload_contract::counter)], 2);
+    EXPECT_EQ(mix.value()[static_cast<std::size_t>(workload_contract::storage)], 0);
+    EXPECT_EQ(mix.value()[static_cast<std::size_t>(workload_contract::hasher)], 1);
+    EXPECT_FALSE(workload_options::parse_contract_mix("counter:x").has_value());
+    EXPECT_FALSE(workload_options::parse_contract_mix("unknown:1").has_value());
+    EXPECT_FALSE(workload_options::parse_contract_mix("counter:0").has_value());
+}
+
+TEST(workload_generator_test, parsed_by_assigner) {
+    workload_options options;
+    options.blocks = 3;
+    options.messages_per_block = 10;
+    options.contracts_per_kind = 2;
+    options.storage_slots = 5;
+    auto generated = generate_workload(options);
+    ASSERT_TRUE(generated.has_value()) << generated.error();
+    ASSERT_EQ(generated->blocks.size(), 3);
+    EXPECT_EQ(generated->messages, 30);
+
+    evmc::accounts accounts;
+    std::istringstream state(generated->state);
+    auto err = init_account_storage(accounts, state);
+    ASSERT_FALSE(err) << err.value();
+    EXPECT_EQ(accounts.size(), 2 * kWorkloadContractKinds);
+    for (const auto& [_, account] : accounts) {
+        EXPECT_FALSE(account.code.empty());
+        EXPECT_EQ(account.storage.size(), 5);
+    }
+
+    for (const auto& block_json : generated->blocks) {
+        core::types::Block block;
+        std::vector<core::types::Message> messages;
+        std::istringstream in(block_json);
+        err = load_block_with_messages(block, messages, in);
+        ASSERT_FALSE(err) << err.value();
+        ASSERT_EQ(messages.size(), 10);
+        for (const auto& message : messages) {
+            EXPECT_TRUE(accounts.contains(to_evmc_address(message.m_to)));
+        }
+    }
+}
+
+TEST(workload_generator_test, deterministic) {
+    workload_options options;
+    options.seed = 42;
+    const auto first = generate_workload(options);
+    const auto second = generate_workload(options);
+    ASSERT_TRUE(first.has_value() && second.has_value());
+    EXPECT_EQ(first->state, second->state);
+    EXPECT_EQ(first->blocks, second->blocks);
+    options.seed = 43;
+    EXPECT_NE(generate_workload(options)->blocks, first->blocks);
+}
@@ -0,0 +1,237 @@
+#include "zkevm_framework/assigner_runner/write_assignments.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/json/parse.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "zkevm_framework/assigner_runner/read_assignments.hpp"
+
+namespace {
+    std::string read_file(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios_base::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+}  // namespace
+
+TEST(write_assignments_test, padded_rows) {
+    EXPECT_EQ(padded_rows(0), 8);
+    EXPECT_EQ(padded_rows(5), 8);
+    EXPECT_EQ(padded_rows(8), 16);
+    EXPECT_EQ(padded_rows(1023), 1024);
+    EXPECT_EQ(padded_rows(1024), 2048);
+}
+
+TEST(write_assignments_test, whole_table) {
+    auto segments = plan_table_segments(100, "table.0", {});
+    ASSERT_EQ(segments.size(), 1);
+    EXPECT_EQ(segments[0].filename, "table.0");
+    EXPECT_EQ(segments[0].begin, 0);
+    EXPECT_EQ(segments[0].end, 100);
+}
+
+TEST(write_assignments_test, segments) {
+    table_output_options options{.segment_rows = 1023};
+    auto segments = plan_table_segments(2500, "table.0", options);
+    ASSERT_EQ(segments.size(), 3);
+    EXPECT_EQ(segments[0].filename, "table.0.seg0");
+    EXPECT_EQ(segments[2].filename, "table.0.seg2");
+    std::size_t next = 0;
+    for (const auto& segment : segments) {
+        EXPECT_EQ(segment.begin, next);
+        EXPECT_EQ(segment.first_row, next);
+        EXPECT_LE(padded_rows(segment.end - segment.begin), 1024);
+        next = segment.end;
+    }
+    EXPECT_EQ(next, 2500);
+}
+
+TEST(write_assignments_test, overlapping_segments) {
+    table_output_options options{.segment_rows = 10, .segment_overlap = 2};
+    auto segments = plan_table_segments(25, "table.0", options);
+    ASSERT_EQ(segments.size(), 3);
+    EXPECT_EQ(segments[0].begin, 0);
+    EXPECT_EQ(segments[0].end, 10);
+    EXPECT_EQ(segments[1].begin, 8);
+    EXPECT_EQ(segments[1].first_row, 10);
+    EXPECT_EQ(segments[1].end, 18);
+    EXPECT_EQ(segments[2].begin, 16);
+    EXPECT_EQ(segments[2].first_row, 18);
+    EXPECT_EQ(segments[2].end, 25);
+}
+
+TEST(write_assignments_test, segments_metadata) {
+    table_output_options options{.segment_rows = 10};
+    auto segments = plan_table_segments(15, "out/table.1", options);
+    auto metadata = boost::json::parse(table_segments_metadata(1, 15, segments, options));
+    const auto& object = metadata.as_object();
+    EXPECT_EQ(object.at("circuit").as_uint64(), 1);
+    EXPECT_EQ(object.at("usable_rows").as_uint64(), 15);
+    const auto& list = object.at("segments").as_array();
+    ASSERT_EQ(list.size(), 2);
+    EXPECT_EQ(list[1].at("file").as_string(), "table.1.seg1");
+    EXPECT_EQ(list[1].at("first_row").as_uint64(), 10);
+    EXPECT_EQ(list[1].at("usable_rows").as_uint64(), 5);
+    EXPECT_EQ(list[1].at("padded_rows").as_uint64(), 8);
+}
+
+TEST(write_assignments_test, shared_static_columns) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using Endianness = nil::marshalling::option::big_endian;
+    using value_type = typename BlueprintFieldType::value_type;
+    using assignments_type = std::unordered_map<nil::evm_assigner::zkevm_circuit,
+                                                nil::blueprint::assignment<ArithmetizationType>>;
+
+    nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc(2, 1, 1, 1);
+    nil::blueprint::assignment<ArithmetizationType> first(desc);
+    nil::blueprint::assignment<ArithmetizationType> second(desc);
+    for (std::size_t row = 0; row < 5; row++) {
+        first.constant(0, row) = second.constant(0, row) = value_type(7);
+        first.selector(0, row) = second.selector(0, row) = value_type(1);
+    }
+    // Blocks fill different number of rows, static columns are shared still
+    for (std::size_t row = 0; row < 3; row++) {
+        first.witness(0, row) = value_type(row);
+    }
+    for (std::size_t row = 0; row < 12; row++) {
+        second.witness(0, row) = value_type(row + 1);
+    }
+
+    const auto dir = std::filesystem::temp_directory_path() / "write_assignments_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto circuit = nil::evm_assigner::zkevm_circuit::BYTECODE;
+    static_columns_cache<Endianness, ArithmetizationType, BlueprintFieldType> cache;
+    for (const auto format : {table_format::plain, table_format::compact}) {
+        table_output_options options{.shared_static_columns = true, .format = format};
+        auto err = write_binary_assignments<Endianness, ArithmetizationType, BlueprintFieldType>(
+            assignments_type{{circuit, first}}, (dir / "block0").string(), options, &cache);
+        ASSERT_FALSE(err.has_value());
+        err = write_binary_assignments<Endianness, ArithmetizationType, BlueprintFieldType>(
+            assignments_type{{circuit, second}}, (dir / "block1").string(), options);
+        ASSERT_FALSE(err.has_value());
+
+        std::size_t static_files = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+            const auto name = entry.path().filename().string();
+            EXPECT_EQ(name.find(".tmp"), std::string::npos);
+            static_files += name.starts_with("static_columns.");
+        }
+        EXPECT_EQ(static_files, format == table_format::plain ? 1 : 2);
+
+        const std::pair<const char*, const nil::blueprint::assignment<ArithmetizationType>*>
+            blocks[] = {{"block0", &first}, {"block1", &second}};
+        for (const auto& [name, table] : blocks) {
+            const auto filename = (dir / (std::string(name) + "." + std::to_string(circuit)));
+            std::string restored;
+            err = restore_shared_assignment_file<Endianness, ArithmetizationType,
+                                                 BlueprintFieldType>(filename.string(), restored);
+            ASSERT_FALSE(err.has_value()) << *err;
+            std::ostringstream full(std::ios_base::binary | std::ios_base::out);
+            write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+                *table, 0, usable_rows(*table), full, format);
+            EXPECT_EQ(restored, full.str());
+        }
+    }
+
+    // Segments reference the same static columns
+    table_output_options options{.segment_rows = 4, .shared_static_columns = true};
+    auto err = write_binary_assignments<Endianness, ArithmetizationType, BlueprintFieldType>(
+        assignments_type{{circuit, second}}, (dir / "segmented").string(), options, &cache);
+    ASSERT_FALSE(err.has_value());
+    const auto filename = dir / ("segmented." + std::to_string(circuit));
+    const auto segments = plan_table_segments(usable_rows(second), filename.string(), options);
+    ASSERT_EQ(segments.size(), 3);
+    for (const auto& segment : segments) {
+        std::string restored;
+        err = restore_shared_assignment_file<Endianness, ArithmetizationType, BlueprintFieldType>(
+            segment.filename, restored);
+        ASSERT_FALSE(err.has_value()) << *err;
+        std::ostringstream full(std::ios_base::binary | std::ios_base::out);
+        write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+            second, segment.begin, segment.end, full);
+        EXPECT_EQ(restored, full.str());
+    }
+
+    // Static columns of another table are rejected
+    const auto block = read_file(dir / ("block0." + std::to_string(circuit)));
+    std::string restored;
+    EXPECT_TRUE((restore_shared_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+                     block, block, restored)
+                     .has_value()));
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(write_assignments_test, compact_format) {
+    using BlueprintFieldType = typename nil::crypto3::algebra::curves::pallas::base_field_type;
+    using ArithmetizationType =
+        nil::crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>;
+    using Endianness = nil::marshalling::option::big_endian;
+    using value_type = typename BlueprintFieldType::value_type;
+
+    nil::crypto3::zk::snark::plonk_table_description<BlueprintFieldType> desc(2, 1, 1, 3);
+    nil::blueprint::assignment<ArithmetizationType> table(desc);
+    for (std::size_t row = 0; row < 1000; row++) {
+        table.witness(0, row) = value_type(row * row);
+        table.witness(1, row) = value_type(row < 600 ? 0 : 42);
+        table.constant(0, row) = value_type(row % 100 == 0 ? row : 0);
+        table.selector(0, row) = value_type(row % 3 == 0 ? 1 : 0);
+        table.selector(2, row) = value_type(1);
+    }
+
+    std::ostringstream plain(std::ios_base::binary | std::ios_base::out);
+    write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(table, plain);
+    std::ostringstream compact(std::ios_base::binary | std::ios_base::out);
+    write_binary_assignment<Endianness, ArithmetizationType, BlueprintFieldType>(
+        table, 0, usable_rows(table), compact, table_format::compact);
+    const auto plain_content = plain.str();
+    const auto compact_content = compact.str();
+    EXPECT_LT(compact_content.size() * 2, plain_content.size());
+
+    binary_table_reader<Endianness, BlueprintFieldType> plain_reader;
+    ASSERT_FALSE(plain_reader.load(plain_content).has_value());
+    EXPECT_EQ(plain_reader.format(), table_format::plain);
+    // Table is read from mapped file in place
+    const auto path = std::filesystem::temp_directory_path() / "write_assignments_test.compact";
+    {
+        std::ofstream out(path, std::ios_base::binary);
+        out << compact_content;
+    }
+    mapped_file file;
+    ASSERT_FALSE(file.open(path.string()).has_value());
+    std::filesystem::remove(path);
+    binary_table_reader<Endianness, BlueprintFieldType> reader;
+    ASSERT_FALSE(
+        reader.load({reinterpret_cast<const char*>(file.data()), file.size()}).has_value());
+    EXPECT_EQ(reader.format(), table_format::compact);
+    EXPECT_EQ(reader.usable_rows(), 1000);
+    EXPECT_EQ(reader.padded_rows(), 1024);
+    ASSERT_EQ(reader.witnesses_amount(), 2);
+    ASSERT_EQ(reader.selectors_amount(), 3);
+
+    for (std::size_t row = 0; row < reader.padded_rows(); row++) {
+        for (std::size_t i = 0; i < 2; i++) {
+            EXPECT_EQ(reader.witness(i, row), plain_reader.witness(i, row));
+        }
+        EXPECT_EQ(reader.public_input(0, row), plain_reader.public_input(0, row));
+        EXPECT_EQ(reader.constant(0, row), plain_reader.constant(0, row));
+        for (std::size_t i = 0; i < 3; i++) {
+            EXPECT_EQ(reader.selector(i, row), plain_reader.selector(i, row));
+        }
+    }
+    EXPECT_EQ(reader.witness(0, 999), value_type(999 * 999));
+    EXPECT_EQ(reader.selector(0, 3), value_type(1));
+
+    const auto truncated = std::string_view(compact_content).substr(0, compact_content.size() - 1);
+    EXPECT_TRUE(reader.load(truncated).has_value());
+}
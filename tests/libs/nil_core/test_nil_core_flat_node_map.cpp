@@ -0,0 +1,66 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "zkevm_framework/core/mpt/flat_node_map.hpp"
+#include "zkevm_framework/core/mpt/node_key.hpp"
+
+using namespace core;
+using namespace core::mpt;
+
+// Digest-like key: first bytes differ for consequent indices
+NodeKey makeKey(std::uint64_t idx, std::size_t size = 32) {
+    std::vector<std::byte> digest(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        digest[i] = static_cast<std::byte>((idx * 0x9E3779B97F4A7C15ULL) >> ((i % 8) * 8));
+    }
+    digest.back() = static_cast<std::byte>(idx);
+    return NodeKey(digest);
+}
+
+TEST(NilCoreFlatNodeMapTest, NodeKey) {
+    auto key = makeKey(42);
+    ASSERT_EQ(key.size(), 32);
+    ASSERT_EQ(NodeKey(key.to_vector()), key);
+    ASSERT_FALSE(makeKey(42, 64) == key);
+    ASSERT_ANY_THROW(NodeKey(std::vector<std::byte>(NodeKey::kMaxSize + 1)));
+}
+
+TEST(NilCoreFlatNodeMapTest, InsertFind) {
+    FlatNodeMap<NodeKey, std::vector<std::byte>, NodeKeyHash> map;
+    ASSERT_EQ(map.find(makeKey(0)), nullptr);
+
+    constexpr std::size_t kCount = 10000;
+    for (std::size_t i = 0; i < kCount; ++i) {
+        ASSERT_TRUE(map.insert_or_assign(makeKey(i), {static_cast<std::byte>(i)}));
+    }
+    ASSERT_EQ(map.size(), kCount);
+
+    for (std::size_t i = 0; i < kCount; ++i) {
+        const auto* value = map.find(makeKey(i));
+        ASSERT_NE(value, nullptr);
+        ASSERT_EQ(*value, std::vector<std::byte>{static_cast<std::byte>(i)});
+    }
+    ASSERT_FALSE(map.contains(makeKey(kCount)));
+
+    // Reassign existing key
+    ASSERT_FALSE(map.insert_or_assign(makeKey(7), {}));
+    ASSERT_EQ(map.size(), kCount);
+    ASSERT_TRUE(map.find(makeKey(7))->empty());
+}
+
+TEST(NilCoreFlatNodeMapTest, Reserve) {
+    FlatNodeMap<NodeKey, int, NodeKeyHash> map;
+    map.reserve(1000);
+    const auto capacity = map.capacity();
+    ASSERT_GE(capacity * 3, 1000 * 4);
+    for (int i = 0; i < 1000; ++i) {
+        map.insert_or_assign(makeKey(i), i);
+    }
+    ASSERT_EQ(map.capacity(), capacity);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(makeKey(1)));
+}
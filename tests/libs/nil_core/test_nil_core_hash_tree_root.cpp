@@ -0,0 +1,58 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ssz++.hpp"
+#include "zkevm_framework/core/hash_tree_root.hpp"
+
+using namespace core;
+using namespace core::types;
+
+namespace {
+    std::vector<Message> make_messages(std::size_t count) {
+        std::vector<Message> messages(count);
+        for (std::size_t i = 0; i < count; i++) {
+            messages[i].m_seqno = i;
+            messages[i].m_to = {std::byte{0x22}, static_cast<std::byte>(i)};
+            messages[i].m_data = {{std::vector<std::byte>(i % 100, std::byte{0xDD})}};
+        }
+        return messages;
+    }
+}  // namespace
+
+TEST(NilCoreHashTreeRootTests, MessagesRootMatchesSSZList) {
+    const auto messages = make_messages(37);
+    ssz::list<Message, MAX_BLOCK_LIST_SIZE> list;
+    list.data() = messages;
+    Hash expected;
+    std::ranges::copy(ssz::hash_tree_root(list), expected.begin());
+    EXPECT_EQ(messages_root(messages, 1), expected);
+}
+
+TEST(NilCoreHashTreeRootTests, ThreadsDontChangeRoot) {
+    const auto messages = make_messages(1000);
+    const auto root = messages_root(messages, 1);
+    EXPECT_EQ(messages_root(messages, 3), root);
+    EXPECT_EQ(messages_root(messages, 0), root);
+    EXPECT_NE(messages_root(std::span(messages).first(999), 4), root);
+    EXPECT_EQ(messages_root({}, 4), messages_root({}, 1));
+}
+
+TEST(NilCoreHashTreeRootTests, MessageView) {
+    auto messages = make_messages(3);
+    // Variable size fields of every kind, data spanning several chunks
+    messages[2].m_currency = std::vector{CurrencyBalance{}, CurrencyBalance{}};
+    messages[2].m_currency[0].m_balance = Value{.m_value = 7};
+    messages[2].m_currency[0].m_currency = {std::byte{0x33}};
+    messages[2].m_currency[1].m_balance = Value{.m_value = 9};
+    messages[2].m_currency[1].m_currency = {std::byte{0x44}};
+    messages[2].m_data = {{std::vector<std::byte>(100, std::byte{0xDD})}};
+    messages[2].m_signature = {{std::vector<std::byte>(65, std::byte{0x5A})}};
+    for (const auto& message : messages) {
+        const auto bytes = ssz::serialize(message);
+        const auto view = MessageView::parse(bytes);
+        ASSERT_TRUE(view.has_value());
+        EXPECT_EQ(hash_tree_root(*view), hash_tree_root(message));
+    }
+}
@@ -1,9 +1,14 @@
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ssz++.hpp"
+#include "zkevm_framework/core/mpt/arena.hpp"
+#include "zkevm_framework/core/mpt/hasher.hpp"
 #include "zkevm_framework/core/mpt/mpt.hpp"
 
 using namespace core;
@@ -76,6 +81,15 @@ TEST(NilCoreMerklePatriciaTrieTest, NodeEncodeDecode) {
 
         ASSERT_EQ(branch.value(), value);
         ASSERT_EQ(branch.get_branches(), branches);
+        for (std::size_t i = 0; i < kBranchesNum; ++i) {
+            ASSERT_EQ(branch.get_branch(std::byte(i)), branches[i]);
+        }
+        ASSERT_EQ(branch.CountBranches(), value.empty() ? 0 : kBranchesNum);
+
+        // Encoding into scratch buffer gives the same bytes
+        Bytes buffer(1000, std::byte{0xFF});
+        branchNode.EncodeTo(buffer);
+        ASSERT_EQ(buffer, serialized);
         current += 'a' + (i % 26);
     }
 }
@@ -120,3 +134,219 @@ TEST(NilCoreMerklePatriciaTrieTest, TestDelete) {
     ASSERT_NO_THROW(trie.get(stringToByteVector("dog")));    // Can access existing
     ASSERT_NO_THROW(trie.get(stringToByteVector("horse")));  // Can access existing
 }
+
+TEST(NilCoreMerklePatriciaTrieTest, ManyKeys) {
+    MerklePatriciaTrie trie;
+
+    constexpr std::size_t kCount = 500;
+    auto key = [](std::size_t i) { return stringToByteVector("key" + std::to_string(i * 7919)); };
+    auto value = [](std::size_t i) { return stringToByteVector("value" + std::to_string(i)); };
+
+    for (std::size_t i = 0; i < kCount; ++i) {
+        ASSERT_NO_THROW(trie.set(key(i), value(i)));
+    }
+    for (std::size_t i = 0; i < kCount; i += 2) {
+        ASSERT_NO_THROW(trie.remove(key(i)));
+    }
+    for (std::size_t i = 0; i < kCount; ++i) {
+        if (i % 2 == 0) {
+            ASSERT_ANY_THROW(trie.get(key(i)));
+        } else {
+            ASSERT_EQ(trie.get(key(i)), value(i));
+        }
+    }
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, DeleteToEmpty) {
+    MerklePatriciaTrie trie;
+    trie.set(stringToByteVector("single"), stringToByteVector(std::string(40, 's')));
+    ASSERT_NO_THROW(trie.remove(stringToByteVector("single")));
+    ASSERT_TRUE(trie.root().empty());
+    ASSERT_FALSE(trie.find(stringToByteVector("single")).has_value());
+
+    constexpr std::size_t kCount = 200;
+    auto key = [](std::size_t i) { return stringToByteVector("key" + std::to_string(i * 7919)); };
+    auto value = [](std::size_t i) { return stringToByteVector(std::string(40, 'a' + i % 26)); };
+    for (std::size_t i = 0; i < kCount; ++i) {
+        trie.set(key(i), value(i));
+    }
+    // Keys are deleted from both ends, branches collapse the same way as in a trie built
+    // without them
+    std::vector<bool> present(kCount, true);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        const auto removed = i % 2 == 0 ? i / 2 : kCount - 1 - i / 2;
+        ASSERT_NO_THROW(trie.remove(key(removed)));
+        present[removed] = false;
+        if (i % 50 == 0) {
+            MerklePatriciaTrie expected;
+            for (std::size_t j = 0; j < kCount; ++j) {
+                if (present[j]) {
+                    expected.set(key(j), value(j));
+                }
+            }
+            ASSERT_EQ(trie.root(), expected.root());
+        }
+    }
+    ASSERT_TRUE(trie.root().empty());
+    // Emptied trie is usable again
+    trie.set(key(0), value(0));
+    ASSERT_EQ(trie.get(key(0)), value(0));
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, ByteArena) {
+    ByteArena arena(16);
+    std::vector<std::span<const std::byte>> stored;
+    for (std::size_t i = 0; i < 40; ++i) {
+        stored.push_back(arena.store(stringToByteVector(std::string(i % 20, 'a' + i % 26))));
+    }
+    for (std::size_t i = 0; i < stored.size(); ++i) {
+        ASSERT_EQ(Bytes(stored[i].begin(), stored[i].end()),
+                  stringToByteVector(std::string(i % 20, 'a' + i % 26)));
+    }
+    ASSERT_GT(arena.allocated_bytes(), 0);
+    arena.clear();
+    ASSERT_EQ(arena.allocated_bytes(), 0);
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, ByteArenaOversizedFirst) {
+    ByteArena arena(16);
+    const auto large = stringToByteVector(std::string(40, 'L'));
+    const auto small = stringToByteVector("small");
+    const auto next = stringToByteVector(std::string(60, 'N'));
+    const auto stored_large = arena.store(large);
+    const auto stored_small = arena.store(small);
+    const auto stored_next = arena.store(next);
+    const auto stored_last = arena.store(small);
+    ASSERT_EQ(Bytes(stored_large.begin(), stored_large.end()), large);
+    ASSERT_EQ(Bytes(stored_small.begin(), stored_small.end()), small);
+    ASSERT_EQ(Bytes(stored_next.begin(), stored_next.end()), next);
+    ASSERT_EQ(Bytes(stored_last.begin(), stored_last.end()), small);
+    // Small buffers share a chunk after the oversized ones
+    ASSERT_EQ(stored_last.data(), stored_small.data() + small.size());
+    ASSERT_EQ(arena.allocated_bytes(), 40 + 60 + 16);
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, Keccak256Hasher) {
+    auto hex = [](const NodeKey& key) {
+        std::string result;
+        for (const auto byte : key.bytes()) {
+            constexpr char kDigits[] = "0123456789abcdef";
+            result.push_back(kDigits[std::to_integer<uint8_t>(byte) >> 4]);
+            result.push_back(kDigits[std::to_integer<uint8_t>(byte) & 0x0F]);
+        }
+        return result;
+    };
+    Keccak256Hasher hasher;
+    ASSERT_EQ(hex(hasher.Hash(stringToByteVector(""))),
+              "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+    ASSERT_EQ(hex(hasher.Hash(stringToByteVector("abc"))),
+              "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+
+    // Batch must agree with single hashing, inputs cross the rate boundary of 136 bytes
+    std::vector<Bytes> inputs;
+    for (std::size_t len : {0, 1, 135, 136, 137, 300}) {
+        inputs.push_back(stringToByteVector(std::string(len, 'x')));
+    }
+    std::vector<std::span<const std::byte>> views(inputs.begin(), inputs.end());
+    std::vector<NodeKey> digests(inputs.size());
+    hasher.HashBatch(views, digests);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        ASSERT_EQ(digests[i], hasher.Hash(inputs[i]));
+    }
+    digests.pop_back();
+    ASSERT_ANY_THROW(hasher.HashBatch(views, digests));
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, BuildMatchesIncremental) {
+    std::vector<std::pair<Bytes, Bytes>> entries;
+    for (const auto* key : {"do", "dog", "doge", "horse", "d", "dogecoin"}) {
+        entries.emplace_back(stringToByteVector(key), stringToByteVector(std::string(key) + "!"));
+    }
+    for (std::size_t i = 0; i < 300; ++i) {
+        entries.emplace_back(stringToByteVector("key" + std::to_string(i * 7919)),
+                             stringToByteVector("value" + std::to_string(i)));
+    }
+    // Long key is hashed, duplicated key keeps the last value
+    entries.emplace_back(stringToByteVector(std::string(40, 'k')), stringToByteVector("long"));
+    entries.emplace_back(stringToByteVector("dog"), stringToByteVector("puppy"));
+
+    MerklePatriciaTrie incremental;
+    for (const auto& [key, value] : entries) {
+        incremental.set(key, value);
+    }
+
+    MerklePatriciaTrie built;
+    built.build(entries);
+    ASSERT_EQ(built.root(), incremental.root());
+    ASSERT_EQ(built.get(stringToByteVector("dog")), stringToByteVector("puppy"));
+    ASSERT_EQ(built.get(stringToByteVector(std::string(40, 'k'))), stringToByteVector("long"));
+
+    // Built trie stays usable for incremental updates
+    built.set(stringToByteVector("cat"), stringToByteVector("meow"));
+    incremental.set(stringToByteVector("cat"), stringToByteVector("meow"));
+    ASSERT_EQ(built.root(), incremental.root());
+
+    MerklePatriciaTrie empty;
+    empty.build({});
+    ASSERT_TRUE(empty.root().empty());
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, ParallelHasher) {
+    std::vector<std::pair<Bytes, Bytes>> entries;
+    for (std::size_t i = 0; i < 2000; ++i) {
+        entries.emplace_back(stringToByteVector("key" + std::to_string(i)),
+                             stringToByteVector(std::string(40, 'a' + i % 26)));
+    }
+    MerklePatriciaTrie sequential;
+    sequential.build(entries);
+    // Small minimal batch makes every height of the trie split between threads
+    MerklePatriciaTrie parallel(std::make_shared<ParallelHasher>(DefaultHasher(), 4, 2));
+    parallel.build(entries);
+    ASSERT_EQ(parallel.root(), sequential.root());
+    ASSERT_EQ(parallel.get(stringToByteVector("key1234")), entries[1234].second);
+    ASSERT_ANY_THROW(ParallelHasher(nullptr));
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, CustomHasher) {
+    MerklePatriciaTrie basic(std::make_shared<BasicHasher>());
+    MerklePatriciaTrie keccak;
+    for (std::size_t i = 0; i < 50; ++i) {
+        const auto key = stringToByteVector("key" + std::to_string(i));
+        basic.set(key, stringToByteVector(std::string(40, 'v')));
+        keccak.set(key, stringToByteVector(std::string(40, 'v')));
+    }
+    ASSERT_EQ(basic.root().size(), 64);
+    ASSERT_EQ(keccak.root().size(), 32);
+    ASSERT_EQ(basic.get(stringToByteVector("key7")), stringToByteVector(std::string(40, 'v')));
+    ASSERT_ANY_THROW(MerklePatriciaTrie(nullptr));
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, LazyLoading) {
+    MerklePatriciaTrie source;
+    for (std::size_t i = 0; i < 200; ++i) {
+        source.set(stringToByteVector("slot" + std::to_string(i)),
+                   stringToByteVector(std::string(40, 'a' + i % 26)));
+    }
+
+    std::size_t loaded = 0;
+    MerklePatriciaTrie lazy(source.root(), [&](const Reference& ref) {
+        ++loaded;
+        return source.find_node(ref);
+    });
+    ASSERT_EQ(lazy.get(stringToByteVector("slot7")), stringToByteVector(std::string(40, 'h')));
+    ASSERT_FALSE(lazy.find(stringToByteVector("missing")).has_value());
+    const auto loaded_for_reads = loaded;
+    ASSERT_GT(loaded_for_reads, 0);
+    ASSERT_LT(loaded_for_reads, 50);  // Only nodes on touched paths
+
+    // Updates load only their paths as well and give the same root as on full trie
+    source.set(stringToByteVector("slot3"), stringToByteVector("updated"));
+    lazy.set(stringToByteVector("slot3"), stringToByteVector("updated"));
+    ASSERT_EQ(lazy.root(), source.root());
+
+    // Nodes not matching their references are rejected
+    MerklePatriciaTrie corrupted(source.root(), [](const Reference&) {
+        return std::optional<Bytes>(Bytes(64, std::byte{1}));
+    });
+    ASSERT_ANY_THROW(corrupted.get(stringToByteVector("slot7")));
+}
@@ -0,0 +1,122 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ssz++.hpp"
+#include "zkevm_framework/core/types/account.hpp"
+#include "zkevm_framework/core/types/block.hpp"
+#include "zkevm_framework/core/types/message.hpp"
+#include "zkevm_framework/core/types/views.hpp"
+
+using namespace core;
+using namespace core::types;
+
+TEST(NilCoreSSZViewsTests, Message) {
+    Message x{};
+    x.m_flags = 0b10101010;
+    x.m_chain_id = 42;
+    x.m_seqno = 47;
+    x.m_feeCredit = Value{.m_value = 2000000};
+    x.m_from = {std::byte{0xEE}};
+    x.m_to = {std::byte{0x22}};
+    x.m_refund_to = {std::byte{0xFF}};
+    x.m_bounce_to = {std::byte{0xAB}};
+    x.m_value = Value{.m_value = 100};
+    x.m_currency = std::vector{CurrencyBalance{}, CurrencyBalance{}};
+    x.m_currency[0].m_balance = Value{.m_value = 43};
+    x.m_data = {{std::vector{std::byte{0xDD}, std::byte{0xDE}, std::byte{0xDF}}}};
+    x.m_signature = {{std::vector{std::byte{0x11}, std::byte{0x12}}}};
+    const std::vector<std::byte> bytes = ssz::serialize(x);
+
+    const auto view = MessageView::parse(bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->flags(), x.m_flags);
+    EXPECT_EQ(view->chain_id(), x.m_chain_id);
+    EXPECT_EQ(view->seqno(), x.m_seqno);
+    EXPECT_EQ(view->fee_credit().m_value, x.m_feeCredit.m_value);
+    EXPECT_EQ(view->from(), x.m_from);
+    EXPECT_EQ(view->to(), x.m_to);
+    EXPECT_EQ(view->refund_to(), x.m_refund_to);
+    EXPECT_EQ(view->bounce_to(), x.m_bounce_to);
+    EXPECT_EQ(view->value().m_value, x.m_value.m_value);
+    EXPECT_EQ(view->currency_count(), 2);
+    EXPECT_EQ(std::vector(view->data().begin(), view->data().end()), x.m_data.data());
+    EXPECT_EQ(std::vector(view->signature().begin(), view->signature().end()),
+              x.m_signature.data());
+    // Fields are not copied
+    EXPECT_GE(view->data().data(), bytes.data());
+    EXPECT_LT(view->data().data(), bytes.data() + bytes.size());
+    EXPECT_EQ(ssz::serialize(view->to_message()), bytes);
+}
+
+TEST(NilCoreSSZViewsTests, MalformedMessage) {
+    Message x{};
+    x.m_data = {{std::vector{std::byte{0xDD}}}};
+    std::vector<std::byte> bytes = ssz::serialize(x);
+    EXPECT_FALSE(MessageView::parse(std::span(bytes).first(MessageView::FIXED_SIZE - 1)));
+    // Offset of signature points past the end
+    bytes[MessageView::SIGNATURE_OFFSET] = std::byte{0xFF};
+    EXPECT_FALSE(MessageView::parse(bytes));
+}
+
+TEST(NilCoreSSZViewsTests, Block) {
+    Block x{};
+    x.m_id = 42;
+    x.m_prev_block = {std::byte{0xFF}};
+    x.m_smart_contracts_root = {std::byte{0x22}};
+    x.m_in_messages_root = {std::byte{0xBB}};
+    x.m_out_messages_root = {std::byte{0xEE}};
+    x.m_out_messages_num = 43;
+    x.m_receipts_root = {std::byte{0x11}};
+    x.m_child_blocks_root_hash = {std::byte{0xAA}};
+    x.m_master_chain_hash = {std::byte{0xDD}};
+    x.m_logs_bloom = {std::byte{0xCC}};
+    x.m_timestamp = 44;
+    x.m_gasPrice = Value{.m_value = 100};
+    const std::vector<std::byte> bytes = ssz::serialize(x);
+
+    const auto view = BlockView::parse(bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->id(), x.m_id);
+    EXPECT_EQ(view->prev_block(), x.m_prev_block);
+    EXPECT_EQ(view->smart_contracts_root(), x.m_smart_contracts_root);
+    EXPECT_EQ(view->in_messages_root(), x.m_in_messages_root);
+    EXPECT_EQ(view->out_messages_root(), x.m_out_messages_root);
+    EXPECT_EQ(view->out_messages_num(), x.m_out_messages_num);
+    EXPECT_EQ(view->receipts_root(), x.m_receipts_root);
+    EXPECT_EQ(view->child_blocks_root_hash(), x.m_child_blocks_root_hash);
+    EXPECT_EQ(view->master_chain_hash(), x.m_master_chain_hash);
+    EXPECT_EQ(view->logs_bloom()[0], std::byte{0xCC});
+    EXPECT_EQ(view->timestamp(), x.m_timestamp);
+    EXPECT_EQ(view->gas_price().m_value, x.m_gasPrice.m_value);
+    EXPECT_EQ(ssz::serialize(view->to_block()), bytes);
+    EXPECT_FALSE(BlockView::parse(std::span(bytes).first(bytes.size() - 1)));
+}
+
+TEST(NilCoreSSZViewsTests, SmartContract) {
+    SmartContract x{};
+    x.m_address = {std::byte{0xAA}};
+    x.m_initialised = true;
+    x.m_balance = Value{.m_value = 42};
+    x.m_currency_root = {std::byte{0xCC}};
+    x.m_storage_root = {std::byte{0xEE}};
+    x.m_code_hash = {std::byte{0xBB}};
+    x.m_seqno = 44;
+    x.m_ext_seqno = 43;
+    x.m_public_key = {std::byte{0xDD}};
+    const std::vector<std::byte> bytes = ssz::serialize(x);
+
+    const auto view = SmartContractView::parse(bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->address(), x.m_address);
+    EXPECT_TRUE(view->initialised());
+    EXPECT_EQ(view->balance().m_value, x.m_balance.m_value);
+    EXPECT_EQ(view->currency_root(), x.m_currency_root);
+    EXPECT_EQ(view->storage_root(), x.m_storage_root);
+    EXPECT_EQ(view->code_hash(), x.m_code_hash);
+    EXPECT_EQ(view->seqno(), x.m_seqno);
+    EXPECT_EQ(view->ext_seqno(), x.m_ext_seqno);
+    EXPECT_EQ(view->public_key()[0], std::byte{0xDD});
+    EXPECT_EQ(ssz::serialize(view->to_smart_contract()), bytes);
+}
@@ -0,0 +1,53 @@
+#include "zkevm_framework/rpc/fixture_server.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/json/parse.hpp>
+#include <filesystem>
+#include <fstream>
+
+class fixture_server_test : public testing::Test {
+  protected:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() / "zkevm_fixture_server_test";
+        std::filesystem::create_directories(m_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    std::filesystem::path m_dir;
+};
+
+TEST_F(fixture_server_test, fixture_name) {
+    EXPECT_EQ(fixture_server::fixture_name("debug_getBlockByHash",
+                                           boost::json::array{1, "0xab", true}),
+              "debug_getBlockByHash.1.0xab.true.json");
+    EXPECT_EQ(fixture_server::fixture_name("debug_getContract", boost::json::array{"../x/y"}),
+              "debug_getContract..._x_y.json");
+}
+
+TEST_F(fixture_server_test, replay) {
+    {
+        std::ofstream out(m_dir / "debug_getContract.0x01.0x02.json");
+        out << R"({"jsonrpc":"2.0","id":1,"result":{"code":"0x00"}})";
+    }
+    fixture_server_options options;
+    options.fixtures_dir = m_dir.string();
+    fixture_server server(options);
+
+    auto response = boost::json::parse(server.handle(
+        R"({"jsonrpc":"2.0","id":7,"method":"debug_getContract","params":["0x01","0x02"]})"));
+    EXPECT_EQ(response.at("id"), 7);
+    EXPECT_EQ(response.at("result").at("code"), "0x00");
+
+    response = boost::json::parse(server.handle(
+        R"({"jsonrpc":"2.0","id":8,"method":"debug_getContract","params":["0x01","0x03"]})"));
+    EXPECT_EQ(response.at("id"), 8);
+    EXPECT_TRUE(response.as_object().contains("error"));
+
+    response = boost::json::parse(server.handle("not json"));
+    EXPECT_TRUE(response.as_object().contains("error"));
+
+    EXPECT_EQ(server.hits(), 1);
+    EXPECT_EQ(server.misses(), 1);
+}